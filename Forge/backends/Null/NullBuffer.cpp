@@ -0,0 +1,253 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "NullBuffer.h"
+#include "Forge/Renderer/RenderAPI.h"
+#include "Forge/Utils/Common.h"
+#include "Forge/Utils/Log.h"
+#include "NullStats.h"
+
+#include <algorithm>
+
+namespace forge {
+
+//========================================
+//  Vertex Buffer Implementation
+//========================================
+
+NullVertexBuffer::NullVertexBuffer(const void* data, uint32_t size, BufferDrawMode drawMode)
+    : m_Size(size)
+    , m_DrawMode(drawMode) {
+    auto& stats = NullDeviceStats::Get();
+    stats.buffersCreated++;
+    if (data) {
+        stats.bytesUploaded += size;
+    }
+}
+
+void NullVertexBuffer::SetLayout(const BufferLayout& layout) {
+    FORGE_ASSERT(ValidateLayout(layout, m_Size), "Vertex buffer size does not match its layout stride");
+    m_Layout = layout;
+}
+
+void NullVertexBuffer::SubmitData(const void* data, uint32_t size, uint32_t offset) {
+    FORGE_ASSERT(offset + size <= m_Size, "Vertex buffer write out of range");
+    Bind();
+
+    if (m_DrawMode != BufferDrawMode::Static) {
+        NullDeviceStats::Get().bytesUploaded += size;
+    } else {
+        FORGE_ASSERT(false, "Can't submit data to a static NullVertexBuffer. Set BufferDrawMode to "
+                            "Dynamic or Stream.");
+    }
+}
+
+void NullVertexBuffer::CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(sourceOffset + size <= offset || offset + size <= sourceOffset, "CopyData ranges overlap");
+    NullDeviceStats::Get().bytesCopied += size;
+}
+
+void* NullVertexBuffer::BeginWrite(uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(m_DrawMode == BufferDrawMode::Stream, "BeginWrite requires BufferDrawMode::Stream");
+    m_WriteScratch.resize(size);
+    return m_WriteScratch.data();
+}
+
+void NullVertexBuffer::EndWrite() {
+    NullDeviceStats::Get().bytesUploaded += m_WriteScratch.size();
+}
+
+void NullVertexBuffer::Bind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullVertexBuffer::Unbind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+//========================================
+//  Index Buffer Implementation
+//========================================
+
+NullIndexBuffer::NullIndexBuffer(const uint32_t* data, uint32_t count, BufferDrawMode drawMode)
+    : m_Count(count)
+    , m_DrawMode(drawMode) {
+    auto& stats = NullDeviceStats::Get();
+    stats.buffersCreated++;
+    if (data) {
+        stats.bytesUploaded += count * sizeof(uint32_t);
+    }
+}
+
+void NullIndexBuffer::SubmitData(const void* data, uint32_t size, uint32_t offset) {
+    FORGE_ASSERT(offset + size <= m_Count * sizeof(uint32_t), "Index buffer write out of range");
+    Bind();
+
+    if (m_DrawMode != BufferDrawMode::Static) {
+        NullDeviceStats::Get().bytesUploaded += size;
+    } else {
+        FORGE_ASSERT(false, "Can't submit data to a static NullIndexBuffer. Set BufferDrawMode to "
+                            "Dynamic or Stream.");
+    }
+}
+
+void NullIndexBuffer::CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(sourceOffset + size <= offset || offset + size <= sourceOffset, "CopyData ranges overlap");
+    NullDeviceStats::Get().bytesCopied += size;
+}
+
+void* NullIndexBuffer::BeginWrite(uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(m_DrawMode == BufferDrawMode::Stream, "BeginWrite requires BufferDrawMode::Stream");
+    m_WriteScratch.resize(size);
+    return m_WriteScratch.data();
+}
+
+void NullIndexBuffer::EndWrite() {
+    NullDeviceStats::Get().bytesUploaded += m_WriteScratch.size();
+}
+
+void NullIndexBuffer::Bind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullIndexBuffer::Unbind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+//========================================
+//  Vertex Array Buffer Implementation
+//========================================
+
+void NullVertexArrayBuffer::Bind() const {
+    NullDeviceStats::Get().vertexArrayBinds++;
+}
+
+void NullVertexArrayBuffer::Unbind() const {
+    NullDeviceStats::Get().vertexArrayBinds++;
+}
+
+void NullVertexArrayBuffer::AddVertexBuffer(Shared<VertexBuffer>& vertexBuffer) {
+    if (vertexBuffer->GetLayout().GetElements().empty()) {
+        Log::Error("NullVertexBuffer has no layout!");
+        return;
+    }
+
+    Bind();
+    vertexBuffer->Bind();
+
+    m_VertexBuffers.push_back(vertexBuffer);
+}
+
+void NullVertexArrayBuffer::SetIndexBuffer(Shared<IndexBuffer>& indexBuffer) {
+    Bind();
+    indexBuffer->Bind();
+
+    m_IndexBuffer = indexBuffer;
+}
+
+//========================================
+//  Uniform Buffer Implementation
+//========================================
+
+NullUniformBuffer::NullUniformBuffer(uint32_t frameCapacity)
+    : m_FrameCapacity((frameCapacity + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT) {
+    m_Storage.resize(static_cast<size_t>(m_FrameCapacity) * MAX_FRAMES_IN_FLIGHT);
+    NullDeviceStats::Get().buffersCreated++;
+}
+
+void NullUniformBuffer::Bind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullUniformBuffer::Unbind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+UniformAllocation NullUniformBuffer::Allocate(uint32_t size) {
+    uint64_t frameIndex = RenderAPI::GetFrameIndex();
+    if (frameIndex != m_FrameIndex) {
+        m_FrameIndex = frameIndex;
+        m_Head = 0;
+    }
+
+    // NOTE: Running out of room is not an error, the owner grows the ring and retries
+    if (m_Head + size > m_FrameCapacity) {
+        return {};
+    }
+
+    uint32_t offset = RenderAPI::GetFrameSlot() * m_FrameCapacity + m_Head;
+    m_Head += (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    NullDeviceStats::Get().bytesUploaded += size;
+
+    return UniformAllocation{m_Storage.data() + offset, offset, size};
+}
+
+void NullUniformBuffer::BindRange(uint32_t binding, const UniformAllocation& allocation) const {
+    FORGE_ASSERT(allocation.IsValid(), "Binding an invalid uniform allocation");
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+//========================================
+//  Storage Buffer Implementation
+//========================================
+
+NullStorageBuffer::NullStorageBuffer(const void* data, uint32_t size, BufferDrawMode drawMode)
+    : m_Size(size)
+    , m_DrawMode(drawMode) {
+    auto& stats = NullDeviceStats::Get();
+    stats.buffersCreated++;
+    if (data) {
+        stats.bytesUploaded += size;
+    }
+}
+
+void NullStorageBuffer::Bind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullStorageBuffer::Unbind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullStorageBuffer::SubmitData(const void* data, uint32_t size, uint32_t offset) {
+    FORGE_ASSERT(offset + size <= m_Size, "Storage buffer write out of range");
+    Bind();
+
+    if (m_DrawMode != BufferDrawMode::Static) {
+        NullDeviceStats::Get().bytesUploaded += size;
+    } else {
+        FORGE_ASSERT(false, "Can't submit data to a static NullStorageBuffer. Set BufferDrawMode to "
+                            "Dynamic or Stream.");
+    }
+}
+
+void NullStorageBuffer::BindBase(uint32_t binding) const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+//========================================
+//  Indirect Buffer Implementation
+//========================================
+
+NullIndirectBuffer::NullIndirectBuffer(uint32_t capacity)
+    : m_Commands(capacity) {
+    NullDeviceStats::Get().buffersCreated++;
+}
+
+void NullIndirectBuffer::Bind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullIndirectBuffer::Unbind() const {
+    NullDeviceStats::Get().bufferBinds++;
+}
+
+void NullIndirectBuffer::SubmitData(const DrawIndexedIndirectCommand* commands, uint32_t count, uint32_t first) {
+    FORGE_ASSERT(first + count <= m_Commands.size(), "Indirect buffer write out of range");
+    Bind();
+
+    std::copy(commands, commands + count, m_Commands.begin() + first);
+    NullDeviceStats::Get().bytesUploaded += count * sizeof(DrawIndexedIndirectCommand);
+}
+
+} // namespace forge
@@ -0,0 +1,145 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLBUFFER_H
+#define NULLBUFFER_H
+
+#include "Forge/Renderer/BufferImpl.h"
+#include <vector>
+
+namespace forge {
+
+class NullVertexBuffer : public VertexBuffer {
+public:
+    using VertexBuffer::SubmitData;
+
+    NullVertexBuffer(const void* data, uint32_t size, BufferDrawMode drawMode);
+    virtual ~NullVertexBuffer() = default;
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    virtual void CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) override;
+    virtual void* BeginWrite(uint32_t offset, uint32_t size) override;
+    virtual void EndWrite() override;
+    virtual const BufferLayout& GetLayout() const override {
+        return m_Layout;
+    }
+    virtual void SetLayout(const BufferLayout& layout) override;
+    virtual uint32_t GetSize() const override {
+        return m_Size;
+    }
+
+private:
+    BufferLayout m_Layout;
+    uint32_t m_Size{0};
+    BufferDrawMode m_DrawMode;
+    std::vector<uint8_t> m_WriteScratch;
+};
+
+class NullIndexBuffer : public IndexBuffer {
+public:
+    using IndexBuffer::SubmitData;
+
+    NullIndexBuffer(const uint32_t* data, uint32_t count, BufferDrawMode drawMode);
+    virtual ~NullIndexBuffer() = default;
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    virtual void CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) override;
+    virtual void* BeginWrite(uint32_t offset, uint32_t size) override;
+    virtual void EndWrite() override;
+    virtual uint32_t GetCount() const override {
+        return m_Count;
+    }
+
+private:
+    uint32_t m_Count;
+    BufferDrawMode m_DrawMode;
+    std::vector<uint8_t> m_WriteScratch;
+};
+
+class NullVertexArrayBuffer : public VertexArrayBuffer {
+public:
+    NullVertexArrayBuffer() = default;
+    virtual ~NullVertexArrayBuffer() = default;
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void AddVertexBuffer(Shared<VertexBuffer>& vertexBuffer) override;
+    virtual void SetIndexBuffer(Shared<IndexBuffer>& indexBuffer) override;
+    virtual const Shared<IndexBuffer>& GetIndexBuffer() const override {
+        return m_IndexBuffer;
+    }
+
+private:
+    std::vector<Shared<VertexBuffer>> m_VertexBuffers;
+    Shared<IndexBuffer> m_IndexBuffer;
+};
+
+class NullUniformBuffer : public UniformBuffer {
+public:
+    explicit NullUniformBuffer(uint32_t frameCapacity);
+    virtual ~NullUniformBuffer() = default;
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual UniformAllocation Allocate(uint32_t size) override;
+    virtual void BindRange(uint32_t binding, const UniformAllocation& allocation) const override;
+    virtual uint32_t GetFrameCapacity() const override {
+        return m_FrameCapacity;
+    }
+
+private:
+    // NOTE: Same layout and alignment as the GL ring so allocation patterns match
+    static constexpr uint32_t ALIGNMENT = 256;
+
+    std::vector<uint8_t> m_Storage;
+    uint32_t m_FrameCapacity{0};
+    uint32_t m_Head{0};
+    uint64_t m_FrameIndex{0};
+};
+
+class NullStorageBuffer : public StorageBuffer {
+public:
+    NullStorageBuffer(const void* data, uint32_t size, BufferDrawMode drawMode);
+    virtual ~NullStorageBuffer() = default;
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    virtual void BindBase(uint32_t binding) const override;
+    virtual uint32_t GetSize() const override {
+        return m_Size;
+    }
+
+private:
+    uint32_t m_Size{0};
+    BufferDrawMode m_DrawMode;
+};
+
+// NOTE: Keeps the commands so the Null device can account for the indices they draw
+class NullIndirectBuffer : public IndirectBuffer {
+public:
+    explicit NullIndirectBuffer(uint32_t capacity);
+    virtual ~NullIndirectBuffer() = default;
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void SubmitData(const DrawIndexedIndirectCommand* commands, uint32_t count, uint32_t first = 0) override;
+    virtual uint32_t GetCapacity() const override {
+        return static_cast<uint32_t>(m_Commands.size());
+    }
+
+    [[nodiscard]] const std::vector<DrawIndexedIndirectCommand>& GetCommands() const noexcept {
+        return m_Commands;
+    }
+
+private:
+    std::vector<DrawIndexedIndirectCommand> m_Commands;
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "NullContext.h"
+#include "Forge/Utils/Log.h"
+#include "NullStats.h"
+
+namespace forge {
+
+NullContext::NullContext(Shared<Window> window)
+    : m_Window(window) {
+    FORGE_ASSERT(window, "Window handle is null!");
+}
+
+NullContext::~NullContext() {
+    NullDeviceStats::Get().Print();
+}
+
+bool NullContext::Init() {
+    NullDeviceStats::Get().Reset();
+
+    Log::Info("Null Graphics Info:");
+    Log::Info("  No GPU calls are issued, only CPU-side costs are measured");
+    return true;
+}
+
+void NullContext::SwapBuffers() {
+    NullDeviceStats::Get().framesPresented++;
+}
+
+void NullContext::MakeCurrent() {}
+
+void* NullContext::GetNativeContext() const {
+    return nullptr;
+}
+
+} // namespace forge
@@ -0,0 +1,27 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLCONTEXT_H
+#define NULLCONTEXT_H
+
+#include "Forge/Renderer/GraphicsContext.h"
+
+namespace forge {
+
+class NullContext final : public GraphicsContext {
+public:
+    explicit NullContext(Shared<Window> window);
+    ~NullContext() override;
+
+    bool Init() override;
+    void SwapBuffers() override;
+    void MakeCurrent() override;
+    void* GetNativeContext() const override;
+
+private:
+    Shared<Window> m_Window;
+};
+
+} // namespace forge
+
+#endif
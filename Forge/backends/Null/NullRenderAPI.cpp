@@ -0,0 +1,76 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "NullRenderAPI.h"
+#include "NullBuffer.h"
+#include "NullStats.h"
+
+namespace forge {
+
+void NullRenderAPI::BeginFrame() {}
+
+void NullRenderAPI::EndFrame() {
+    s_FrameIndex++;
+}
+
+void NullRenderAPI::Clear(const ClearState& state) {
+    NullDeviceStats::Get().clears++;
+}
+
+void NullRenderAPI::DrawIndexed(const Shared<VertexArrayBuffer>& vertexArray, uint32_t indexCount) {
+    FORGE_ASSERT(vertexArray && vertexArray->GetIndexBuffer(), "DrawIndexed requires a vertex array with an index buffer");
+
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    vertexArray->Bind();
+
+    auto& stats = NullDeviceStats::Get();
+    stats.drawCalls++;
+    stats.indicesSubmitted += count;
+}
+
+void NullRenderAPI::DrawIndexedInstanced(const Shared<VertexArrayBuffer>& vertexArray, uint32_t instanceCount,
+                                         uint32_t indexCount) {
+    FORGE_ASSERT(vertexArray && vertexArray->GetIndexBuffer(),
+                 "DrawIndexedInstanced requires a vertex array with an index buffer");
+
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    vertexArray->Bind();
+
+    auto& stats = NullDeviceStats::Get();
+    stats.drawCalls++;
+    stats.instancesSubmitted += instanceCount;
+    stats.indicesSubmitted += static_cast<uint64_t>(count) * instanceCount;
+}
+
+void NullRenderAPI::DrawIndexedIndirect(const Shared<VertexArrayBuffer>& vertexArray,
+                                        const Shared<IndirectBuffer>& indirectBuffer, uint32_t drawCount, uint32_t firstDraw) {
+    FORGE_ASSERT(vertexArray && vertexArray->GetIndexBuffer(),
+                 "DrawIndexedIndirect requires a vertex array with an index buffer");
+    FORGE_ASSERT(indirectBuffer && firstDraw + drawCount <= indirectBuffer->GetCapacity(),
+                 "DrawIndexedIndirect reads past the end of the indirect buffer");
+
+    vertexArray->Bind();
+    indirectBuffer->Bind();
+
+    auto& stats = NullDeviceStats::Get();
+    stats.drawCalls++;
+    stats.indirectCommands += drawCount;
+
+    const auto& commands = static_cast<const NullIndirectBuffer&>(*indirectBuffer).GetCommands();
+    for (uint32_t i = firstDraw; i < firstDraw + drawCount; i++) {
+        stats.indicesSubmitted += static_cast<uint64_t>(commands[i].indexCount) * commands[i].instanceCount;
+    }
+}
+
+void NullRenderAPI::SubmitDraw(const DrawCommand& command) {
+    uint32_t count = command.indexCount ? command.indexCount : command.vertexArray->GetIndexBuffer()->GetCount();
+
+    auto& stats = NullDeviceStats::Get();
+    stats.drawCalls++;
+    if (command.instanceCount > 1) {
+        stats.instancesSubmitted += command.instanceCount;
+    }
+    stats.indicesSubmitted += static_cast<uint64_t>(count) * command.instanceCount;
+}
+
+} // namespace forge
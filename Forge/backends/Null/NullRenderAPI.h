@@ -0,0 +1,31 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLRENDERAPI_H
+#define NULLRENDERAPI_H
+
+#include "Forge/Renderer/RenderAPI.h"
+
+namespace forge {
+
+class NullRenderAPI final : public RenderAPI {
+public:
+    NullRenderAPI() = default;
+    ~NullRenderAPI() override = default;
+
+    void BeginFrame() override;
+    void EndFrame() override;
+
+    void Clear(const ClearState& state) override;
+    void DrawIndexed(const Shared<VertexArrayBuffer>& vertexArray, uint32_t indexCount = 0) override;
+    void DrawIndexedInstanced(const Shared<VertexArrayBuffer>& vertexArray, uint32_t instanceCount,
+                              uint32_t indexCount = 0) override;
+    void DrawIndexedIndirect(const Shared<VertexArrayBuffer>& vertexArray, const Shared<IndirectBuffer>& indirectBuffer,
+                             uint32_t drawCount, uint32_t firstDraw = 0) override;
+
+protected:
+    void SubmitDraw(const DrawCommand& command) override;
+};
+
+} // namespace forge
+#endif
@@ -0,0 +1,38 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "NullResourceLoader.h"
+#include "Forge/Utils/Log.h"
+
+namespace forge {
+
+void NullResourceLoader::Enqueue(LoadFn load, ReadyFn ready) {
+    m_Jobs.push_back(Job{std::move(load), std::move(ready)});
+}
+
+void NullResourceLoader::Poll() {
+    // NOTE: Jobs submitted from a ready callback wait for the next Poll
+    size_t count = m_Jobs.size();
+    for (size_t i = 0; i < count; i++) {
+        Job job = std::move(m_Jobs.front());
+        m_Jobs.pop_front();
+
+        bool loaded = false;
+        try {
+            loaded = job.load();
+        } catch (const std::exception& e) {
+            Log::Error("Resource load failed: {}", e.what());
+        }
+
+        if (!loaded) {
+            m_Stats.jobsFailed++;
+            continue;
+        }
+
+        m_Stats.jobsLoaded++;
+        job.ready();
+        m_Stats.jobsPublished++;
+    }
+}
+
+} // namespace forge
@@ -0,0 +1,41 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLRESOURCELOADER_H
+#define NULLRESOURCELOADER_H
+
+#include "Forge/Renderer/ResourceLoader.h"
+
+#include <deque>
+
+namespace forge {
+
+// NOTE: Runs both halves of a job on the render thread in Poll, so jobs still publish one
+// frame after they were submitted but no second context or thread is involved
+class NullResourceLoader final : public ResourceLoader {
+public:
+    void Poll() override;
+
+    [[nodiscard]] uint32_t GetPendingCount() const noexcept override {
+        return static_cast<uint32_t>(m_Jobs.size());
+    }
+    [[nodiscard]] const ResourceLoaderStats& GetStats() const noexcept override {
+        return m_Stats;
+    }
+
+protected:
+    void Enqueue(LoadFn load, ReadyFn ready) override;
+
+private:
+    struct Job {
+        LoadFn load;
+        ReadyFn ready;
+    };
+
+    std::deque<Job> m_Jobs;
+    ResourceLoaderStats m_Stats;
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,39 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "NullShader.h"
+#include "NullStats.h"
+
+namespace forge {
+
+NullShader::NullShader(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV) noexcept {
+    for (const auto& [type, spirv_binary] : shaderSPIRV) {
+        m_Reflection.Reflect(spirv_binary, type);
+    }
+
+    NullDeviceStats::Get().shadersCreated++;
+}
+
+void NullShader::Bind() const {
+    NullDeviceStats::Get().shaderBinds++;
+}
+
+void NullShader::UnBind() const {
+    NullDeviceStats::Get().shaderBinds++;
+}
+
+bool NullShaderBuildTask::Prepare(ShaderSPIRVMap& spirvBinaries) {
+    m_Shader = CreateShared<NullShader>(spirvBinaries);
+    return true;
+}
+
+ShaderBuildStatus NullShaderBuildTask::Poll(Shared<Shader>& outShader) {
+    if (!m_Shader) {
+        return ShaderBuildStatus::Failed;
+    }
+
+    outShader = std::move(m_Shader);
+    return ShaderBuildStatus::Ready;
+}
+
+} // namespace forge
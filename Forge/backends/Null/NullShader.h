@@ -0,0 +1,75 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLSHADER_H
+#define NULLSHADER_H
+
+#include "Forge/Renderer/Shader.h"
+#include "Forge/Renderer/Shader/AsyncShader.h"
+#include "Forge/Renderer/Shader/ShaderReflection.h"
+#include <unordered_map>
+#include <vector>
+
+namespace forge {
+
+// NOTE: Runs the full SPIR-V reflection like the real backends but never
+// creates a GPU program
+class NullShader final : public Shader {
+public:
+    explicit NullShader(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV) noexcept;
+    ~NullShader() override = default;
+
+    void Bind() const override;
+    void UnBind() const override;
+
+    // Reflection interface
+    [[nodiscard]] const std::vector<ShaderResource>& GetUniformBuffers() const noexcept override {
+        return m_Reflection.GetUniformBuffers();
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetStorageBuffers() const noexcept override {
+        return m_Reflection.GetStorageBuffers();
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetSamplers() const noexcept override {
+        return m_Reflection.GetSamplers();
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetStageInputs() const noexcept override {
+        return m_Reflection.GetStageInputs();
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetStageOutputs() const noexcept override {
+        return m_Reflection.GetStageOutputs();
+    }
+
+    [[nodiscard]] bool HasUniformBuffer(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.HasUniformBuffer(name);
+    }
+    [[nodiscard]] bool HasStorageBuffer(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.HasStorageBuffer(name);
+    }
+    [[nodiscard]] bool HasSampler(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.HasSampler(name);
+    }
+
+    [[nodiscard]] const ShaderResource* FindResource(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.FindResource(name);
+    }
+    [[nodiscard]] const ShaderResource* FindResourceByBinding(uint32_t binding, uint32_t set = 0) const noexcept override {
+        return m_Reflection.FindResourceByBinding(binding, set);
+    }
+
+private:
+    ShaderReflection m_Reflection;
+};
+
+// NOTE: Nothing to do on the context thread, the shader is built on the worker
+class NullShaderBuildTask final : public ShaderBuildTask {
+public:
+    [[nodiscard]] bool Prepare(ShaderSPIRVMap& spirvBinaries) override;
+    [[nodiscard]] ShaderBuildStatus Poll(Shared<Shader>& outShader) override;
+
+private:
+    Shared<NullShader> m_Shader;
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,44 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "NullStats.h"
+#include "Forge/Utils/Log.h"
+
+namespace forge {
+
+NullDeviceStats& NullDeviceStats::Get() {
+    static NullDeviceStats s_Stats;
+    return s_Stats;
+}
+
+void NullDeviceStats::Reset() {
+    buffersCreated = 0;
+    bytesUploaded = 0;
+    bytesCopied = 0;
+    bufferBinds = 0;
+    vertexArrayBinds = 0;
+    shadersCreated = 0;
+    shaderBinds = 0;
+    clears = 0;
+    drawCalls = 0;
+    indicesSubmitted = 0;
+    instancesSubmitted = 0;
+    indirectCommands = 0;
+    framesPresented = 0;
+}
+
+void NullDeviceStats::Print() const {
+    Log::Info("Null device statistics:");
+    Log::Info("  Frames presented: {}", framesPresented.load());
+    Log::Info("  Buffers created: {} ({} bytes uploaded)", buffersCreated.load(), bytesUploaded.load());
+    Log::Info("  Bytes copied on the device: {}", bytesCopied.load());
+    Log::Info("  Buffer binds: {}", bufferBinds.load());
+    Log::Info("  Vertex array binds: {}", vertexArrayBinds.load());
+    Log::Info("  Shaders created: {} ({} binds)", shadersCreated.load(), shaderBinds.load());
+    Log::Info("  Clears: {}", clears.load());
+    Log::Info("  Draw calls: {} ({} indices, {} instances)", drawCalls.load(), indicesSubmitted.load(),
+              instancesSubmitted.load());
+    Log::Info("  Indirect commands: {}", indirectCommands.load());
+}
+
+} // namespace forge
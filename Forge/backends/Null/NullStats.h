@@ -0,0 +1,37 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLSTATS_H
+#define NULLSTATS_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace forge {
+
+// NOTE: Counters recorded by the Null backend in place of the GPU calls
+// the real backends would issue, used to profile the CPU submission path
+struct NullDeviceStats {
+    std::atomic<uint64_t> buffersCreated{0};
+    std::atomic<uint64_t> bytesUploaded{0};
+    std::atomic<uint64_t> bytesCopied{0};
+    std::atomic<uint64_t> bufferBinds{0};
+    std::atomic<uint64_t> vertexArrayBinds{0};
+    std::atomic<uint64_t> shadersCreated{0};
+    std::atomic<uint64_t> shaderBinds{0};
+    std::atomic<uint64_t> clears{0};
+    std::atomic<uint64_t> drawCalls{0};
+    std::atomic<uint64_t> indicesSubmitted{0};
+    std::atomic<uint64_t> instancesSubmitted{0};
+    std::atomic<uint64_t> indirectCommands{0};
+    std::atomic<uint64_t> framesPresented{0};
+
+    static NullDeviceStats& Get();
+
+    void Reset();
+    void Print() const;
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,73 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef NULLWINDOW_H
+#define NULLWINDOW_H
+
+#include "Forge/Events/EventQueue.h"
+#include "Forge/Renderer/Window.h"
+
+#include <chrono>
+#include <thread>
+
+namespace forge {
+
+// NOTE: Headless window used together with the Null graphics backend, it
+// never opens a native surface and produces no events of its own. Replays
+// still feed recorded events through it.
+class NullWindow final : public Window {
+public:
+    explicit NullWindow(const WindowDescriptor& descriptor)
+        : m_Width(descriptor.width)
+        , m_Height(descriptor.height) {}
+    ~NullWindow() override = default;
+
+    void SetEventCallback(const EventCallbackFn& callback) override {
+        m_EventCallback = callback;
+    }
+
+    void* GetNativeWindow() const override {
+        return nullptr;
+    }
+    void EnableVSync(bool enable) override {
+        m_VSyncEnabled = enable;
+    }
+    void Update() override {
+        DispatchEvents();
+    }
+    // NOTE: No live event ever arrives, so waiting always runs into the timeout
+    void WaitEvents(double timeout) override {
+        std::this_thread::sleep_for(std::chrono::duration<double>(timeout));
+        DispatchEvents();
+    }
+
+    inline uint32_t GetWidth() const override {
+        return m_Width;
+    }
+    inline uint32_t GetHeight() const override {
+        return m_Height;
+    }
+    inline bool IsVSyncEnabled() const override {
+        return m_VSyncEnabled;
+    }
+    inline bool IsFullscreen() const override {
+        return false;
+    }
+
+private:
+    void DispatchEvents() {
+        ProcessEvents(m_Events, [this](const EventRecord& record) {
+            SendEvent(record, m_EventCallback);
+        });
+    }
+
+    uint32_t m_Width{};
+    uint32_t m_Height{};
+    bool m_VSyncEnabled{false};
+    EventCallbackFn m_EventCallback;
+    EventQueue m_Events;
+};
+
+} // namespace forge
+
+#endif
@@ -2,6 +2,10 @@
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 
 #include "OpenGLBuffer.h"
+#include "OpenGLBufferStorage.h"
+#include "OpenGLContext.h"
+#include "OpenGLStateCache.h"
+#include "Forge/Renderer/RenderAPI.h"
 #include "Forge/Utils/Common.h"
 #include "Forge/Utils/Log.h"
 
@@ -31,6 +35,18 @@ uint32_t GetComponentCount(BufferDataType type) {
         return 4;
     case BufferDataType::Bool:
         return 1;
+    case BufferDataType::Half2:
+    case BufferDataType::UShort2Norm:
+    case BufferDataType::Short2Norm:
+        return 2;
+    case BufferDataType::Half4:
+    case BufferDataType::UByte4:
+    case BufferDataType::UByte4Norm:
+    case BufferDataType::Byte4Norm:
+    case BufferDataType::Short4Norm:
+    case BufferDataType::Int2_10_10_10_Rev:
+    case BufferDataType::UInt2_10_10_10_Rev:
+        return 4;
     default:
         return 0;
     }
@@ -51,96 +67,157 @@ GLenum BufferDataTypeToOpenGLBaseType(BufferDataType type) {
     case BufferDataType::Int4:
         return GL_INT;
     case BufferDataType::Bool:
-        return GL_BOOL;
+    case BufferDataType::UByte4:
+    case BufferDataType::UByte4Norm:
+        return GL_UNSIGNED_BYTE;
+    case BufferDataType::Half2:
+    case BufferDataType::Half4:
+        return GL_HALF_FLOAT;
+    case BufferDataType::Byte4Norm:
+        return GL_BYTE;
+    case BufferDataType::UShort2Norm:
+        return GL_UNSIGNED_SHORT;
+    case BufferDataType::Short2Norm:
+    case BufferDataType::Short4Norm:
+        return GL_SHORT;
+    case BufferDataType::Int2_10_10_10_Rev:
+        return GL_INT_2_10_10_10_REV;
+    case BufferDataType::UInt2_10_10_10_Rev:
+        return GL_UNSIGNED_INT_2_10_10_10_REV;
     default:
         FORGE_ASSERT(false, "Unknown BufferDataType!");
         return 0;
     }
 }
 
+static void* BeginStreamWrite(OpenGLStagingAllocation& pending, uint32_t& pendingOffset, uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(!pending.IsValid(), "BeginWrite called again before EndWrite");
+
+    pending = OpenGLStagingRing::Get().Allocate(size);
+    FORGE_ASSERT(pending.IsValid(), "Stream write does not fit the staging ring");
+    pending.size = size;
+    pendingOffset = offset;
+    return pending.data;
+}
+
+static void EndStreamWrite(OpenGLStagingAllocation& pending, uint32_t pendingOffset, GLuint destination) {
+    FORGE_ASSERT(pending.IsValid(), "EndWrite called without BeginWrite");
+
+    OpenGLStagingRing::Get().Copy(pending, destination, pendingOffset);
+    pending = {};
+}
+
 //========================================
 //  Vertex Buffer Implementation
 //========================================
 
-OpenGLVertexBuffer::OpenGLVertexBuffer(const void* data, uint32_t count, BufferDrawMode drawMode)
-    : m_DrawMode(drawMode) {
-    glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+OpenGLVertexBuffer::OpenGLVertexBuffer(const void* data, uint32_t size, BufferDrawMode drawMode)
+    : m_Size(size)
+    , m_DrawMode(drawMode) {
+    m_RendererID = CreateOpenGLBuffer();
+    AllocateOpenGLBuffer(m_RendererID, size, data, drawMode);
+}
 
-    switch (drawMode) {
-    case BufferDrawMode::Static:
-        glBufferData(GL_ARRAY_BUFFER, count * sizeof(float), data, GL_STATIC_DRAW);
-        break;
+void OpenGLVertexBuffer::SetLayout(const BufferLayout& layout) {
+    FORGE_ASSERT(ValidateLayout(layout, m_Size), "Vertex buffer size does not match its layout stride");
+    m_Layout = layout;
+}
+
+void OpenGLVertexBuffer::SubmitData(const void* data, uint32_t size, uint32_t offset) {
+    FORGE_ASSERT(offset + size <= m_Size, "Vertex buffer write out of range");
+
+    switch (m_DrawMode) {
     case BufferDrawMode::Dynamic:
-        glBufferData(GL_ARRAY_BUFFER, count * sizeof(float), data, GL_DYNAMIC_DRAW);
+        UpdateOpenGLBuffer(m_RendererID, offset, size, data);
+        break;
+    case BufferDrawMode::Stream:
+        OpenGLStagingRing::Get().Upload(m_RendererID, data, size, offset);
+        break;
+    case BufferDrawMode::Static:
+        FORGE_ASSERT(false, "Can't submit data to a static OpenGLVertexBuffer. Set BufferDrawMode to "
+                            "Dynamic or Stream.");
         break;
     }
 }
 
-void OpenGLVertexBuffer::SubmitData(const void* data, uint32_t count, uint32_t offset) {
-    Bind();
+void* OpenGLVertexBuffer::BeginWrite(uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(m_DrawMode == BufferDrawMode::Stream, "BeginWrite requires BufferDrawMode::Stream");
+    return BeginStreamWrite(m_PendingWrite, m_PendingOffset, offset, size);
+}
 
-    if (m_DrawMode == BufferDrawMode::Dynamic) {
-        glBufferSubData(GL_ARRAY_BUFFER, offset, count, data);
-    } else {
-        FORGE_ASSERT(false, "Can't submit data to a static OpenGLVertexBuffer. Set BufferDrawMode to "
-                            "Dynamic.");
-    }
+void OpenGLVertexBuffer::EndWrite() {
+    EndStreamWrite(m_PendingWrite, m_PendingOffset, m_RendererID);
+}
+
+void OpenGLVertexBuffer::CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(sourceOffset + size <= offset || offset + size <= sourceOffset, "CopyData ranges overlap");
+    CopyOpenGLBuffer(m_RendererID, m_RendererID, sourceOffset, offset, size);
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer() {
-    glDeleteBuffers(1, &m_RendererID);
+    DeleteOpenGLBuffer(m_RendererID);
 }
 
 void OpenGLVertexBuffer::Bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 }
 
 void OpenGLVertexBuffer::Unbind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 //========================================
 //  Index Buffer Implementation
 //========================================
 
-OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* data, uint32_t count, BufferDrawMode drawMode)
+OpenGLIndexBuffer::OpenGLIndexBuffer(const uint32_t* data, uint32_t count, BufferDrawMode drawMode)
     : m_Count(count)
     , m_DrawMode(drawMode) {
-    glGenBuffers(1, &m_RendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    m_RendererID = CreateOpenGLBuffer();
+    AllocateOpenGLBuffer(m_RendererID, count * sizeof(uint32_t), data, drawMode);
+}
 
-    switch (drawMode) {
-    case BufferDrawMode::Static:
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), data, GL_STATIC_DRAW);
-        break;
+void OpenGLIndexBuffer::SubmitData(const void* data, uint32_t size, uint32_t offset) {
+    FORGE_ASSERT(offset + size <= m_Count * sizeof(uint32_t), "Index buffer write out of range");
+
+    switch (m_DrawMode) {
     case BufferDrawMode::Dynamic:
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), data, GL_DYNAMIC_DRAW);
+        UpdateOpenGLBuffer(m_RendererID, offset, size, data);
+        break;
+    case BufferDrawMode::Stream:
+        OpenGLStagingRing::Get().Upload(m_RendererID, data, size, offset);
+        break;
+    case BufferDrawMode::Static:
+        FORGE_ASSERT(false, "Can't submit data to a static OpenGLIndexBuffer. Set BufferDrawMode to "
+                            "Dynamic or Stream.");
         break;
     }
 }
 
-void OpenGLIndexBuffer::SubmitData(const void* data, uint32_t count, uint32_t offset) {
-    Bind();
+void* OpenGLIndexBuffer::BeginWrite(uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(m_DrawMode == BufferDrawMode::Stream, "BeginWrite requires BufferDrawMode::Stream");
+    return BeginStreamWrite(m_PendingWrite, m_PendingOffset, offset, size);
+}
+
+void OpenGLIndexBuffer::EndWrite() {
+    EndStreamWrite(m_PendingWrite, m_PendingOffset, m_RendererID);
+}
 
-    if (m_DrawMode == BufferDrawMode::Dynamic) {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, count, data);
-    } else {
-        FORGE_ASSERT(false, "Can't submit data to a static OpenGLIndexBuffer. Set BufferDrawMode to "
-                            "Dynamic.");
-    }
+void OpenGLIndexBuffer::CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(sourceOffset + size <= offset || offset + size <= sourceOffset, "CopyData ranges overlap");
+    CopyOpenGLBuffer(m_RendererID, m_RendererID, sourceOffset, offset, size);
 }
 
 OpenGLIndexBuffer::~OpenGLIndexBuffer() {
-    glDeleteBuffers(1, &m_RendererID);
+    DeleteOpenGLBuffer(m_RendererID);
 }
 
 void OpenGLIndexBuffer::Bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+    OpenGLStateCache::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
 }
 
 void OpenGLIndexBuffer::Unbind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    OpenGLStateCache::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
 //========================================
@@ -148,19 +225,24 @@ void OpenGLIndexBuffer::Unbind() const {
 //========================================
 
 OpenGLVertexArrayBuffer::OpenGLVertexArrayBuffer() {
-    glGenVertexArrays(1, &m_RendererID);
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glCreateVertexArrays(1, &m_RendererID);
+    } else {
+        glGenVertexArrays(1, &m_RendererID);
+    }
 }
 
 OpenGLVertexArrayBuffer::~OpenGLVertexArrayBuffer() {
+    OpenGLStateCache::Get().OnVertexArrayDeleted(m_RendererID);
     glDeleteVertexArrays(1, &m_RendererID);
 }
 
 void OpenGLVertexArrayBuffer::Bind() const {
-    glBindVertexArray(m_RendererID);
+    OpenGLStateCache::Get().BindVertexArray(m_RendererID);
 }
 
 void OpenGLVertexArrayBuffer::Unbind() const {
-    glBindVertexArray(0);
+    OpenGLStateCache::Get().BindVertexArray(0);
 }
 
 void OpenGLVertexArrayBuffer::AddVertexBuffer(Shared<VertexBuffer>& vertexBuffer) {
@@ -168,27 +250,208 @@ void OpenGLVertexArrayBuffer::AddVertexBuffer(Shared<VertexBuffer>& vertexBuffer
         Log::Error("OpenGLVertexBuffer has no layout!");
         return;
     }
-
-    glBindVertexArray(m_RendererID);
-    vertexBuffer->Bind();
+    FORGE_ASSERT(vertexBuffer->GetSize() % vertexBuffer->GetLayout().GetStride() == 0,
+                 "Vertex buffer size does not match its layout stride");
 
     const auto& layout = vertexBuffer->GetLayout();
-    uint32_t index = 0;
+    GLuint buffer = static_cast<OpenGLVertexBuffer&>(*vertexBuffer).GetRendererID();
+    bool directStateAccess = OpenGLContext::HasDirectStateAccess();
+
+    // NOTE: With direct state access every vertex buffer gets its own binding point that
+    // carries the stride and divisor, attributes only describe their format within it
+    GLuint binding = static_cast<GLuint>(m_VertexBuffers.size());
+    if (directStateAccess) {
+        glVertexArrayVertexBuffer(m_RendererID, binding, buffer, 0, layout.GetStride());
+        glVertexArrayBindingDivisor(m_RendererID, binding, layout.GetDivisor());
+    } else {
+        OpenGLStateCache::Get().BindVertexArray(m_RendererID);
+        OpenGLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, buffer);
+    }
+
     for (const auto& element : layout) {
-        glEnableVertexAttribArray(index);
-        glVertexAttribPointer(index, GetComponentCount(element.type), BufferDataTypeToOpenGLBaseType(element.type), GL_FALSE,
-                              layout.GetStride(), (const void*)(intptr_t)element.offset);
-        index++;
+        // Matrices are passed as one vector attribute per column
+        uint32_t columns = 1;
+        if (element.type == BufferDataType::Mat3) {
+            columns = 3;
+        } else if (element.type == BufferDataType::Mat4) {
+            columns = 4;
+        }
+
+        uint32_t componentCount = GetComponentCount(element.type) / columns;
+        uint32_t columnSize = element.size / columns;
+        GLenum baseType = BufferDataTypeToOpenGLBaseType(element.type);
+        // Integer inputs need the I variant, the plain one would convert them to float
+        bool integer = IsIntegerDataType(element.type);
+        GLboolean normalized = element.normalized ? GL_TRUE : GL_FALSE;
+        for (uint32_t column = 0; column < columns; column++) {
+            uint32_t offset = element.offset + column * columnSize;
+            if (directStateAccess) {
+                glEnableVertexArrayAttrib(m_RendererID, m_AttributeIndex);
+                if (integer) {
+                    glVertexArrayAttribIFormat(m_RendererID, m_AttributeIndex, componentCount, baseType, offset);
+                } else {
+                    glVertexArrayAttribFormat(m_RendererID, m_AttributeIndex, componentCount, baseType, normalized, offset);
+                }
+                glVertexArrayAttribBinding(m_RendererID, m_AttributeIndex, binding);
+            } else {
+                const void* pointer = (const void*)(intptr_t)offset;
+                glEnableVertexAttribArray(m_AttributeIndex);
+                if (integer) {
+                    glVertexAttribIPointer(m_AttributeIndex, componentCount, baseType, layout.GetStride(), pointer);
+                } else {
+                    glVertexAttribPointer(m_AttributeIndex, componentCount, baseType, normalized, layout.GetStride(), pointer);
+                }
+                glVertexAttribDivisor(m_AttributeIndex, layout.GetDivisor());
+            }
+            m_AttributeIndex++;
+        }
     }
 
     m_VertexBuffers.push_back(vertexBuffer);
 }
 
 void OpenGLVertexArrayBuffer::SetIndexBuffer(Shared<IndexBuffer>& indexBuffer) {
-    glBindVertexArray(m_RendererID);
-    indexBuffer->Bind();
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glVertexArrayElementBuffer(m_RendererID, static_cast<OpenGLIndexBuffer&>(*indexBuffer).GetRendererID());
+    } else {
+        OpenGLStateCache::Get().BindVertexArray(m_RendererID);
+        indexBuffer->Bind();
+    }
 
     m_IndexBuffer = indexBuffer;
 }
 
+//========================================
+//  Uniform Buffer Implementation
+//========================================
+
+OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t frameCapacity) {
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    if (alignment > 0) {
+        m_Alignment = static_cast<uint32_t>(alignment);
+    }
+
+    // NOTE: Every frame region starts aligned so offsets stay valid for glBindBufferRange
+    m_FrameCapacity = (frameCapacity + m_Alignment - 1) / m_Alignment * m_Alignment;
+    GLsizeiptr totalSize = static_cast<GLsizeiptr>(m_FrameCapacity) * MAX_FRAMES_IN_FLIGHT;
+
+    m_RendererID = CreateOpenGLBuffer();
+    m_MappedData = static_cast<uint8_t*>(CreatePersistentOpenGLBuffer(m_RendererID, totalSize));
+
+    FORGE_ASSERT(m_MappedData, "Failed to persistently map uniform buffer");
+}
+
+OpenGLUniformBuffer::~OpenGLUniformBuffer() {
+    if (m_MappedData) {
+        UnmapOpenGLBuffer(m_RendererID);
+    }
+    DeleteOpenGLBuffer(m_RendererID);
+}
+
+void OpenGLUniformBuffer::Bind() const {
+    OpenGLStateCache::Get().BindBuffer(GL_UNIFORM_BUFFER, m_RendererID);
+}
+
+void OpenGLUniformBuffer::Unbind() const {
+    OpenGLStateCache::Get().BindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+UniformAllocation OpenGLUniformBuffer::Allocate(uint32_t size) {
+    // First allocation of a new frame starts over in that frame's region
+    uint64_t frameIndex = RenderAPI::GetFrameIndex();
+    if (frameIndex != m_FrameIndex) {
+        m_FrameIndex = frameIndex;
+        m_Head = 0;
+    }
+
+    // NOTE: Running out of room is not an error, the owner grows the ring and retries
+    if (!m_MappedData || m_Head + size > m_FrameCapacity) {
+        return {};
+    }
+
+    uint32_t offset = RenderAPI::GetFrameSlot() * m_FrameCapacity + m_Head;
+    m_Head += (size + m_Alignment - 1) / m_Alignment * m_Alignment;
+
+    return UniformAllocation{m_MappedData + offset, offset, size};
+}
+
+void OpenGLUniformBuffer::BindRange(uint32_t binding, const UniformAllocation& allocation) const {
+    FORGE_ASSERT(allocation.IsValid(), "Binding an invalid uniform allocation");
+    OpenGLStateCache::Get().BindBufferRange(GL_UNIFORM_BUFFER, binding, m_RendererID, allocation.offset, allocation.size);
+}
+
+//========================================
+//  Storage Buffer Implementation
+//========================================
+
+OpenGLStorageBuffer::OpenGLStorageBuffer(const void* data, uint32_t size, BufferDrawMode drawMode)
+    : m_Size(size)
+    , m_DrawMode(drawMode) {
+    m_RendererID = CreateOpenGLBuffer();
+    AllocateOpenGLBuffer(m_RendererID, size, data, drawMode);
+}
+
+OpenGLStorageBuffer::~OpenGLStorageBuffer() {
+    DeleteOpenGLBuffer(m_RendererID);
+}
+
+void OpenGLStorageBuffer::Bind() const {
+    OpenGLStateCache::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, m_RendererID);
+}
+
+void OpenGLStorageBuffer::Unbind() const {
+    OpenGLStateCache::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void OpenGLStorageBuffer::SubmitData(const void* data, uint32_t size, uint32_t offset) {
+    FORGE_ASSERT(offset + size <= m_Size, "Storage buffer write out of range");
+
+    switch (m_DrawMode) {
+    case BufferDrawMode::Dynamic:
+        UpdateOpenGLBuffer(m_RendererID, offset, size, data);
+        break;
+    case BufferDrawMode::Stream:
+        OpenGLStagingRing::Get().Upload(m_RendererID, data, size, offset);
+        break;
+    case BufferDrawMode::Static:
+        FORGE_ASSERT(false, "Can't submit data to a static OpenGLStorageBuffer. Set BufferDrawMode to "
+                            "Dynamic or Stream.");
+        break;
+    }
+}
+
+void OpenGLStorageBuffer::BindBase(uint32_t binding) const {
+    OpenGLStateCache::Get().BindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID, 0, m_Size);
+}
+
+//========================================
+//  Indirect Buffer Implementation
+//========================================
+
+OpenGLIndirectBuffer::OpenGLIndirectBuffer(uint32_t capacity)
+    : m_Capacity(capacity) {
+    m_RendererID = CreateOpenGLBuffer();
+    AllocateOpenGLBuffer(m_RendererID,
+                         static_cast<GLsizeiptr>(capacity) * sizeof(DrawIndexedIndirectCommand), nullptr, BufferDrawMode::Dynamic);
+}
+
+OpenGLIndirectBuffer::~OpenGLIndirectBuffer() {
+    DeleteOpenGLBuffer(m_RendererID);
+}
+
+void OpenGLIndirectBuffer::Bind() const {
+    OpenGLStateCache::Get().BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_RendererID);
+}
+
+void OpenGLIndirectBuffer::Unbind() const {
+    OpenGLStateCache::Get().BindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void OpenGLIndirectBuffer::SubmitData(const DrawIndexedIndirectCommand* commands, uint32_t count, uint32_t first) {
+    FORGE_ASSERT(first + count <= m_Capacity, "Indirect buffer write out of range");
+    UpdateOpenGLBuffer(m_RendererID, static_cast<GLintptr>(first) * sizeof(DrawIndexedIndirectCommand),
+                       static_cast<GLsizeiptr>(count) * sizeof(DrawIndexedIndirectCommand), commands);
+}
+
 } // namespace forge
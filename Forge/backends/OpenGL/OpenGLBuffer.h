@@ -4,6 +4,7 @@
 #ifndef OPENGLBUFFER_H
 #define OPENGLBUFFER_H
 
+#include "OpenGLStagingRing.h"
 #include "Forge/Renderer/BufferImpl.h"
 #include "glad/glad.h"
 
@@ -11,41 +12,63 @@ namespace forge {
 
 class OpenGLVertexBuffer : public VertexBuffer {
 public:
-    OpenGLVertexBuffer(const void* data, uint32_t count, BufferDrawMode drawMode);
+    using VertexBuffer::SubmitData;
+
+    OpenGLVertexBuffer(const void* data, uint32_t size, BufferDrawMode drawMode);
     virtual ~OpenGLVertexBuffer();
 
     virtual void Bind() const override;
     virtual void Unbind() const override;
-    virtual void SubmitData(const void* data, uint32_t count, uint32_t offset = 0) override;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    virtual void CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) override;
+    virtual void* BeginWrite(uint32_t offset, uint32_t size) override;
+    virtual void EndWrite() override;
     virtual const BufferLayout& GetLayout() const override {
         return m_Layout;
     }
-    virtual void SetLayout(const BufferLayout& layout) override {
-        m_Layout = layout;
+    virtual void SetLayout(const BufferLayout& layout) override;
+    virtual uint32_t GetSize() const override {
+        return m_Size;
+    }
+    [[nodiscard]] GLuint GetRendererID() const noexcept {
+        return m_RendererID;
     }
 
 private:
     uint32_t m_RendererID;
     BufferLayout m_Layout;
+    uint32_t m_Size{0};
     BufferDrawMode m_DrawMode;
+    OpenGLStagingAllocation m_PendingWrite;
+    uint32_t m_PendingOffset{0};
 };
 
 class OpenGLIndexBuffer : public IndexBuffer {
 public:
-    OpenGLIndexBuffer(uint32_t* data, uint32_t count, BufferDrawMode drawMode);
+    using IndexBuffer::SubmitData;
+
+    OpenGLIndexBuffer(const uint32_t* data, uint32_t count, BufferDrawMode drawMode);
     virtual ~OpenGLIndexBuffer();
 
     virtual void Bind() const override;
     virtual void Unbind() const override;
-    virtual void SubmitData(const void* data, uint32_t count, uint32_t offset = 0) override;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    virtual void CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) override;
+    virtual void* BeginWrite(uint32_t offset, uint32_t size) override;
+    virtual void EndWrite() override;
     virtual uint32_t GetCount() const override {
         return m_Count;
     }
+    [[nodiscard]] GLuint GetRendererID() const noexcept {
+        return m_RendererID;
+    }
 
 private:
     uint32_t m_RendererID;
     uint32_t m_Count;
     BufferDrawMode m_DrawMode;
+    OpenGLStagingAllocation m_PendingWrite;
+    uint32_t m_PendingOffset{0};
 };
 
 class OpenGLVertexArrayBuffer : public VertexArrayBuffer {
@@ -65,6 +88,65 @@ private:
     std::vector<Shared<VertexBuffer>> m_VertexBuffers;
     Shared<IndexBuffer> m_IndexBuffer;
     uint32_t m_RendererID;
+    uint32_t m_AttributeIndex{0};
+};
+
+class OpenGLUniformBuffer : public UniformBuffer {
+public:
+    explicit OpenGLUniformBuffer(uint32_t frameCapacity);
+    virtual ~OpenGLUniformBuffer();
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual UniformAllocation Allocate(uint32_t size) override;
+    virtual void BindRange(uint32_t binding, const UniformAllocation& allocation) const override;
+    virtual uint32_t GetFrameCapacity() const override {
+        return m_FrameCapacity;
+    }
+
+private:
+    uint32_t m_RendererID{0};
+    uint8_t* m_MappedData{nullptr};
+    uint32_t m_FrameCapacity{0};
+    uint32_t m_Alignment{256};
+    uint32_t m_Head{0};
+    uint64_t m_FrameIndex{0};
+};
+
+class OpenGLStorageBuffer : public StorageBuffer {
+public:
+    OpenGLStorageBuffer(const void* data, uint32_t size, BufferDrawMode drawMode);
+    virtual ~OpenGLStorageBuffer();
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) override;
+    virtual void BindBase(uint32_t binding) const override;
+    virtual uint32_t GetSize() const override {
+        return m_Size;
+    }
+
+private:
+    uint32_t m_RendererID{0};
+    uint32_t m_Size{0};
+    BufferDrawMode m_DrawMode;
+};
+
+class OpenGLIndirectBuffer : public IndirectBuffer {
+public:
+    explicit OpenGLIndirectBuffer(uint32_t capacity);
+    virtual ~OpenGLIndirectBuffer();
+
+    virtual void Bind() const override;
+    virtual void Unbind() const override;
+    virtual void SubmitData(const DrawIndexedIndirectCommand* commands, uint32_t count, uint32_t first = 0) override;
+    virtual uint32_t GetCapacity() const override {
+        return m_Capacity;
+    }
+
+private:
+    uint32_t m_RendererID{0};
+    uint32_t m_Capacity{0};
 };
 
 uint32_t GetComponentCount(BufferDataType type);
@@ -0,0 +1,100 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "OpenGLBufferStorage.h"
+#include "OpenGLContext.h"
+#include "OpenGLStateCache.h"
+
+namespace forge {
+
+static GLenum GetOpenGLUsage(BufferDrawMode drawMode) {
+    return drawMode == BufferDrawMode::Static ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW;
+}
+
+// NOTE: Without direct state access every edit goes through the copy write target. Binding
+// to the buffer's own target would replace the index buffer of whatever vertex array is
+// bound for GL_ELEMENT_ARRAY_BUFFER, the copy targets are not part of any other state.
+static constexpr GLenum EDIT_TARGET = GL_COPY_WRITE_BUFFER;
+
+GLuint CreateOpenGLBuffer() {
+    GLuint buffer = 0;
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glCreateBuffers(1, &buffer);
+    } else {
+        // NOTE: glGenBuffers only reserves the name, the object exists after the first bind
+        glGenBuffers(1, &buffer);
+        OpenGLStateCache::Get().BindBuffer(EDIT_TARGET, buffer);
+    }
+    return buffer;
+}
+
+void DeleteOpenGLBuffer(GLuint buffer) {
+    OpenGLStateCache::Get().OnBufferDeleted(buffer);
+    glDeleteBuffers(1, &buffer);
+}
+
+void AllocateOpenGLBuffer(GLuint buffer, GLsizeiptr size, const void* data, BufferDrawMode drawMode) {
+    if (OpenGLContext::HasDirectStateAccess()) {
+        if (drawMode == BufferDrawMode::Stream) {
+            glNamedBufferStorage(buffer, size, data, 0);
+        } else {
+            glNamedBufferData(buffer, size, data, GetOpenGLUsage(drawMode));
+        }
+        return;
+    }
+
+    OpenGLStateCache::Get().BindBuffer(EDIT_TARGET, buffer);
+    if (drawMode == BufferDrawMode::Stream) {
+        glBufferStorage(EDIT_TARGET, size, data, 0);
+    } else {
+        glBufferData(EDIT_TARGET, size, data, GetOpenGLUsage(drawMode));
+    }
+}
+
+void UpdateOpenGLBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glNamedBufferSubData(buffer, offset, size, data);
+        return;
+    }
+
+    OpenGLStateCache::Get().BindBuffer(EDIT_TARGET, buffer);
+    glBufferSubData(EDIT_TARGET, offset, size, data);
+}
+
+void CopyOpenGLBuffer(GLuint source, GLuint destination, GLintptr sourceOffset, GLintptr offset, GLsizeiptr size) {
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glCopyNamedBufferSubData(source, destination, sourceOffset, offset, size);
+        return;
+    }
+
+    // NOTE: The copy targets leave the vertex array and uniform bindings untouched
+    auto& state = OpenGLStateCache::Get();
+    state.BindBuffer(GL_COPY_READ_BUFFER, source);
+    state.BindBuffer(GL_COPY_WRITE_BUFFER, destination);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, offset, size);
+}
+
+void* CreatePersistentOpenGLBuffer(GLuint buffer, GLsizeiptr size) {
+    constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glNamedBufferStorage(buffer, size, nullptr, flags);
+        return glMapNamedBufferRange(buffer, 0, size, flags);
+    }
+
+    OpenGLStateCache::Get().BindBuffer(EDIT_TARGET, buffer);
+    glBufferStorage(EDIT_TARGET, size, nullptr, flags);
+    return glMapBufferRange(EDIT_TARGET, 0, size, flags);
+}
+
+void UnmapOpenGLBuffer(GLuint buffer) {
+    if (OpenGLContext::HasDirectStateAccess()) {
+        glUnmapNamedBuffer(buffer);
+        return;
+    }
+
+    OpenGLStateCache::Get().BindBuffer(EDIT_TARGET, buffer);
+    glUnmapBuffer(EDIT_TARGET);
+}
+
+} // namespace forge
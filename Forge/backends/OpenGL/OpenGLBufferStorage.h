@@ -0,0 +1,33 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef OPENGLBUFFERSTORAGE_H
+#define OPENGLBUFFERSTORAGE_H
+
+#include "Forge/Renderer/BufferImpl.h"
+#include <glad/glad.h>
+
+namespace forge {
+
+// NOTE: Buffer object operations shared by the OpenGL backend. With direct state access
+// (GL 4.5) they work on the buffer name and leave every binding alone. Without it they
+// fall back to binding the buffer to GL_COPY_WRITE_BUFFER through the state cache first,
+// which leaves the vertex array bindings alone too, so callers never have to care which
+// path is active.
+
+[[nodiscard]] GLuint CreateOpenGLBuffer();
+void DeleteOpenGLBuffer(GLuint buffer);
+
+// Static and dynamic buffers keep mutable storage so they can be respecified, stream
+// buffers are immutable and only ever written by copies from the staging ring
+void AllocateOpenGLBuffer(GLuint buffer, GLsizeiptr size, const void* data, BufferDrawMode drawMode);
+void UpdateOpenGLBuffer(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data);
+void CopyOpenGLBuffer(GLuint source, GLuint destination, GLintptr sourceOffset, GLintptr offset, GLsizeiptr size);
+
+// Immutable storage mapped for writing for the lifetime of the buffer
+[[nodiscard]] void* CreatePersistentOpenGLBuffer(GLuint buffer, GLsizeiptr size);
+void UnmapOpenGLBuffer(GLuint buffer);
+
+} // namespace forge
+
+#endif
@@ -2,6 +2,9 @@
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 
 #include "OpenGLContext.h"
+#include "OpenGLProgramCache.h"
+#include "OpenGLStagingRing.h"
+#include "OpenGLStateCache.h"
 #include "Forge/Renderer/Window.h"
 #include "Forge/Utils/Log.h"
 
@@ -15,6 +18,10 @@ OpenGLContext::OpenGLContext(Shared<Window> window)
 
 OpenGLContext::~OpenGLContext() {
     // OpenGL context is automatically destroyed with the window
+    OpenGLStagingRing::Get().Shutdown();
+
+    const auto& stats = OpenGLStateCache::Get().GetStats();
+    Log::Info("GL state cache: {} calls issued, {} redundant calls elided", stats.issued, stats.elided);
 }
 
 bool OpenGLContext::Init() {
@@ -32,18 +39,26 @@ bool OpenGLContext::Init() {
     Log::Info("  Renderer: {0}", (const char*)glGetString(GL_RENDERER));
     Log::Info("  Version: {0}", (const char*)glGetString(GL_VERSION));
 
+    s_DirectStateAccess = GLAD_GL_VERSION_4_5 != 0;
+    Log::Info("  Direct state access: {0}", s_DirectStateAccess ? "enabled" : "unavailable");
+
 // Setup debug output if supported
 #ifdef RESHAPE_BUILD_DEBUG
     m_DebugContextEnabled = true;
     SetupDebugCallbacks();
 #endif
 
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS); // Make sure depth function is explicitly set
+    OpenGLProgramCache::Get().Init();
+    OpenGLStagingRing::Get().Init();
+
+    auto& state = OpenGLStateCache::Get();
+    state.Invalidate();
+    state.SetCapability(GL_DEPTH_TEST, true);
+    state.DepthFunc(GL_LESS); // Make sure depth function is explicitly set
 
-    glEnable(GL_CULL_FACE);
-    glFrontFace(GL_CCW); // Counter-clockwise winding for front faces
-    glCullFace(GL_BACK); // Cull back faces
+    state.SetCapability(GL_CULL_FACE, true);
+    state.FrontFace(GL_CCW); // Counter-clockwise winding for front faces
+    state.CullFace(GL_BACK); // Cull back faces
 
     return true;
 }
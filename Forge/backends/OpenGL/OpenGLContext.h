@@ -20,6 +20,12 @@ public:
     void MakeCurrent() override;
     void* GetNativeContext() const override;
 
+    // NOTE: Decided once GLAD is loaded, buffers and vertex arrays use the GL 4.5 direct
+    // state access entry points when set and bind-to-edit otherwise
+    [[nodiscard]] static bool HasDirectStateAccess() noexcept {
+        return s_DirectStateAccess;
+    }
+
 private:
     void SetupDebugCallbacks();
     static void APIENTRY GLDebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message,
@@ -27,6 +33,8 @@ private:
 
     Shared<Window> m_Window;
     bool m_DebugContextEnabled = false;
+
+    static inline bool s_DirectStateAccess = false;
 };
 
 } // namespace forge
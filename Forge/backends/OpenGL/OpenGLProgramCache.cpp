@@ -0,0 +1,151 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "OpenGLProgramCache.h"
+#include "Forge/Utils/FileSystem.h"
+#include "Forge/Utils/Hash.h"
+#include "Forge/Utils/Log.h"
+
+#include <algorithm>
+#include <fstream>
+#include <glad/glad.h>
+#include <string_view>
+
+namespace forge {
+
+static constexpr const char* PROGRAM_CACHE_DIRECTORY = "programs";
+static constexpr uint32_t PROGRAM_CACHE_MAGIC = 0x42505746; // "FWPB"
+static constexpr uint32_t PROGRAM_CACHE_VERSION = 1;
+
+struct ProgramBinaryHeader {
+    uint32_t magic{PROGRAM_CACHE_MAGIC};
+    uint32_t version{PROGRAM_CACHE_VERSION};
+    uint32_t format{0};
+    uint32_t size{0};
+};
+
+OpenGLProgramCache& OpenGLProgramCache::Get() {
+    static OpenGLProgramCache s_Cache;
+    return s_Cache;
+}
+
+void OpenGLProgramCache::Init() {
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount <= 0) {
+        Log::Info("Driver exposes no program binary formats, program cache disabled");
+        return;
+    }
+
+    uint64_t driverHash = FNV_OFFSET_BASIS;
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        const char* value = reinterpret_cast<const char*>(glGetString(name));
+        driverHash = HashString(value ? std::string_view(value) : std::string_view(), driverHash);
+    }
+
+    m_DriverHash = driverHash;
+    m_CachePath = FileSystem::GetShaderCachePath() / PROGRAM_CACHE_DIRECTORY;
+    FileSystem::CreateDirectoryIfNotExists(m_CachePath);
+    m_Enabled.store(true, std::memory_order_release);
+}
+
+uint64_t OpenGLProgramCache::MakeKey(const ShaderSPIRVMap& spirvBinaries) const noexcept {
+    // NOTE: Stage order in the map is unspecified, sort so the key is stable across runs
+    std::vector<ShaderType> types;
+    types.reserve(spirvBinaries.size());
+    for (const auto& [type, spirv] : spirvBinaries) {
+        types.push_back(type);
+    }
+    std::sort(types.begin(), types.end());
+
+    uint64_t key = m_DriverHash;
+    for (ShaderType type : types) {
+        const auto& spirv = spirvBinaries.at(type);
+        key = HashCombine(key, static_cast<uint64_t>(type));
+        key = HashCombine(key, HashBytes(spirv.data(), spirv.size() * sizeof(uint32_t)));
+    }
+    return key;
+}
+
+std::optional<OpenGLProgramBinary> OpenGLProgramCache::Load(uint64_t key) const {
+    if (!IsEnabled()) {
+        return std::nullopt;
+    }
+
+    std::ifstream inFile(GetBinaryPath(key), std::ios::binary);
+    if (!inFile) {
+        return std::nullopt;
+    }
+
+    ProgramBinaryHeader header;
+    inFile.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (inFile.gcount() != sizeof(header) || header.magic != PROGRAM_CACHE_MAGIC || header.version != PROGRAM_CACHE_VERSION) {
+        Log::Warn("Program cache entry {} has an unknown format", HashToHex(key));
+        return std::nullopt;
+    }
+
+    OpenGLProgramBinary binary;
+    binary.format = header.format;
+    binary.data.resize(header.size);
+    inFile.read(reinterpret_cast<char*>(binary.data.data()), header.size);
+    if (static_cast<size_t>(inFile.gcount()) != header.size) {
+        Log::Warn("Program cache entry {} is truncated", HashToHex(key));
+        return std::nullopt;
+    }
+
+    return binary;
+}
+
+void OpenGLProgramCache::Store(uint64_t key, unsigned int programID) {
+    if (!IsEnabled()) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    ProgramBinaryHeader header;
+    std::vector<uint8_t> data(static_cast<size_t>(length));
+    GLenum format = 0;
+    glGetProgramBinary(programID, length, nullptr, &format, data.data());
+    header.format = format;
+    header.size = static_cast<uint32_t>(data.size());
+
+    // NOTE: Written to a temporary file first, workers may be reading the final path
+    auto binaryPath = GetBinaryPath(key);
+    auto tempPath = binaryPath;
+    tempPath += ".tmp";
+    {
+        std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+        if (!outFile) {
+            Log::Error("Failed to open program cache file: {}", tempPath.string());
+            return;
+        }
+        outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        outFile.write(reinterpret_cast<const char*>(data.data()), header.size);
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, binaryPath, error);
+    if (error) {
+        Log::Error("Failed to store program cache file {}: {}", binaryPath.string(), error.message());
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+
+    Log::Trace("Cached program binary {} ({} bytes)", HashToHex(key), header.size);
+}
+
+void OpenGLProgramCache::Invalidate(uint64_t key) {
+    std::error_code error;
+    std::filesystem::remove(GetBinaryPath(key), error);
+}
+
+std::filesystem::path OpenGLProgramCache::GetBinaryPath(uint64_t key) const {
+    return m_CachePath / (HashToHex(key) + ".bin");
+}
+
+} // namespace forge
@@ -0,0 +1,55 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef OPENGLPROGRAMCACHE_H
+#define OPENGLPROGRAMCACHE_H
+
+#include "Forge/Renderer/Shader/ShaderCompiler.h"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace forge {
+
+struct OpenGLProgramBinary {
+    uint32_t format{0};
+    std::vector<uint8_t> data;
+};
+
+// NOTE: Linked program binaries from glGetProgramBinary, stored next to the SPIR-V cache.
+// Binaries are only valid for the driver that produced them, so the key combines the
+// SPIR-V of every stage with the GL vendor, renderer and version strings. Lookups are
+// file reads only and can run on worker threads, everything else needs the context.
+class OpenGLProgramCache {
+public:
+    static OpenGLProgramCache& Get();
+
+    // NOTE: Called once the context is current, the cache stays disabled without it
+    void Init();
+
+    [[nodiscard]] bool IsEnabled() const noexcept {
+        return m_Enabled.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] uint64_t MakeKey(const ShaderSPIRVMap& spirvBinaries) const noexcept;
+
+    [[nodiscard]] std::optional<OpenGLProgramBinary> Load(uint64_t key) const;
+    void Store(uint64_t key, unsigned int programID);
+    // NOTE: Drops a binary the driver refused so it is rebuilt and stored again
+    void Invalidate(uint64_t key);
+
+private:
+    OpenGLProgramCache() = default;
+
+    [[nodiscard]] std::filesystem::path GetBinaryPath(uint64_t key) const;
+
+    std::filesystem::path m_CachePath;
+    uint64_t m_DriverHash{0};
+    std::atomic<bool> m_Enabled{false};
+};
+
+} // namespace forge
+
+#endif
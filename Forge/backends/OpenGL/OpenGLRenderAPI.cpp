@@ -2,29 +2,124 @@
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 
 #include "OpenGLRenderAPI.h"
+#include "OpenGLStagingRing.h"
+#include "OpenGLStateCache.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
 #include <glad/glad.h>
 
 namespace forge {
 
+// NOTE: Not done in the destructor, the instance is held by a static and may be destroyed
+// after the context is gone
+void OpenGLRenderAPI::ReleaseResources() {
+    for (GLsync& fence : m_FrameFences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+void OpenGLRenderAPI::BeginFrame() {
+    GLsync& fence = m_FrameFences[GetFrameSlot()];
+    if (!fence) {
+        return;
+    }
+
+    // NOTE: Only blocks when the GPU is more than MAX_FRAMES_IN_FLIGHT frames behind
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    while (result == GL_TIMEOUT_EXPIRED) {
+        PROFILE_SCOPE("OpenGLRenderAPI::WaitForFrame");
+        result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+    }
+    if (result == GL_WAIT_FAILED) {
+        Log::Error("Waiting on frame fence failed");
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void OpenGLRenderAPI::EndFrame() {
+    // NOTE: Staging space used by this frame's uploads is released with its own fence
+    OpenGLStagingRing::Get().Fence();
+
+    GLsync& fence = m_FrameFences[GetFrameSlot()];
+    if (fence) {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    s_FrameIndex++;
+}
+
 void OpenGLRenderAPI::Clear(const ClearState& state) {
     GLbitfield mask = 0;
 
     if (state.clearColor) {
         mask |= GL_COLOR_BUFFER_BIT;
-        glClearColor(state.color.r, state.color.g, state.color.b, state.color.a);
+        OpenGLStateCache::Get().ClearColor(state.color.r, state.color.g, state.color.b, state.color.a);
     }
 
     if (state.clearDepth) {
         mask |= GL_DEPTH_BUFFER_BIT;
-        glClearDepth(state.depth);
+        OpenGLStateCache::Get().ClearDepth(state.depth);
     }
 
     if (state.clearStencil) {
         mask |= GL_STENCIL_BUFFER_BIT;
-        glClearStencil(state.stencil);
+        OpenGLStateCache::Get().ClearStencil(state.stencil);
     }
 
     glClear(mask);
 }
 
+void OpenGLRenderAPI::DrawIndexed(const Shared<VertexArrayBuffer>& vertexArray, uint32_t indexCount) {
+    FORGE_ASSERT(vertexArray && vertexArray->GetIndexBuffer(), "DrawIndexed requires a vertex array with an index buffer");
+
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    vertexArray->Bind();
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+}
+
+void OpenGLRenderAPI::DrawIndexedInstanced(const Shared<VertexArrayBuffer>& vertexArray, uint32_t instanceCount,
+                                           uint32_t indexCount) {
+    FORGE_ASSERT(vertexArray && vertexArray->GetIndexBuffer(),
+                 "DrawIndexedInstanced requires a vertex array with an index buffer");
+
+    uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+    vertexArray->Bind();
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
+}
+
+void OpenGLRenderAPI::DrawIndexedIndirect(const Shared<VertexArrayBuffer>& vertexArray,
+                                          const Shared<IndirectBuffer>& indirectBuffer, uint32_t drawCount, uint32_t firstDraw) {
+    FORGE_ASSERT(vertexArray && vertexArray->GetIndexBuffer(),
+                 "DrawIndexedIndirect requires a vertex array with an index buffer");
+    FORGE_ASSERT(indirectBuffer && firstDraw + drawCount <= indirectBuffer->GetCapacity(),
+                 "DrawIndexedIndirect reads past the end of the indirect buffer");
+
+    if (drawCount == 0) {
+        return;
+    }
+
+    vertexArray->Bind();
+    indirectBuffer->Bind();
+
+    const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(firstDraw) * sizeof(DrawIndexedIndirectCommand));
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, offset, drawCount, 0);
+}
+
+void OpenGLRenderAPI::SubmitDraw(const DrawCommand& command) {
+    uint32_t count = command.indexCount ? command.indexCount : command.vertexArray->GetIndexBuffer()->GetCount();
+    const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(command.firstIndex) * sizeof(uint32_t));
+
+    if (command.instanceCount > 1) {
+        glDrawElementsInstancedBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, indexOffset, command.instanceCount,
+                                          command.baseVertex);
+    } else {
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, indexOffset, command.baseVertex);
+    }
+}
+
 } // namespace forge
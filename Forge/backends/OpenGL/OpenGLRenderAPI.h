@@ -5,6 +5,8 @@
 #define OPENGLRENDERAPI_H
 
 #include "Forge/Renderer/RenderAPI.h"
+#include <array>
+#include <glad/glad.h>
 
 namespace forge {
 
@@ -13,7 +15,23 @@ public:
     OpenGLRenderAPI() = default;
     ~OpenGLRenderAPI() override = default;
 
+    void BeginFrame() override;
+    void EndFrame() override;
+
     void Clear(const ClearState& state) override;
+    void DrawIndexed(const Shared<VertexArrayBuffer>& vertexArray, uint32_t indexCount = 0) override;
+    void DrawIndexedInstanced(const Shared<VertexArrayBuffer>& vertexArray, uint32_t instanceCount,
+                              uint32_t indexCount = 0) override;
+    void DrawIndexedIndirect(const Shared<VertexArrayBuffer>& vertexArray, const Shared<IndirectBuffer>& indirectBuffer,
+                             uint32_t drawCount, uint32_t firstDraw = 0) override;
+
+protected:
+    void SubmitDraw(const DrawCommand& command) override;
+    void ReleaseResources() override;
+
+private:
+    // One fence per frame slot, signaled at the end of the frame that used it
+    std::array<GLsync, MAX_FRAMES_IN_FLIGHT> m_FrameFences{};
 };
 
 } // namespace forge
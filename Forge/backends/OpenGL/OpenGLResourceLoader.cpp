@@ -0,0 +1,172 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "OpenGLResourceLoader.h"
+#include "OpenGLStateCache.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+namespace forge {
+
+OpenGLResourceLoader::OpenGLResourceLoader(const Shared<Window>& window) {
+    FORGE_ASSERT(window, "Window handle is null!");
+
+    // NOTE: The context hints set for the main window still apply, so both contexts match
+    auto* mainWindow = static_cast<GLFWwindow*>(window->GetNativeWindow());
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    m_LoaderWindow = glfwCreateWindow(1, 1, "Reshape Loader", nullptr, mainWindow);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+    if (!m_LoaderWindow) {
+        Log::Warn("Failed to create the shared loader context, resources are loaded on the render thread");
+        return;
+    }
+
+    m_Thread = std::thread(&OpenGLResourceLoader::LoaderLoop, this);
+}
+
+OpenGLResourceLoader::~OpenGLResourceLoader() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+
+    if (m_Thread.joinable()) {
+        m_Thread.join();
+    }
+
+    // NOTE: Sync objects are shared, the ones the loader left behind are deleted from here
+    for (LoadedJob& job : m_Loaded) {
+        if (job.fence) {
+            glDeleteSync(job.fence);
+        }
+    }
+    m_Loaded.clear();
+    m_Jobs.clear();
+
+    if (m_LoaderWindow) {
+        glfwDestroyWindow(m_LoaderWindow);
+    }
+
+    Log::Info("Resource loader: {} jobs loaded, {} failed, {} published", m_Stats.jobsLoaded, m_Stats.jobsFailed,
+              m_Stats.jobsPublished);
+}
+
+bool OpenGLResourceLoader::RunLoad(const LoadFn& load) {
+    try {
+        return load();
+    } catch (const std::exception& e) {
+        Log::Error("Resource load failed: {}", e.what());
+    }
+    return false;
+}
+
+void OpenGLResourceLoader::Enqueue(LoadFn load, ReadyFn ready) {
+    m_Pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Jobs.push_back(Job{std::move(load), std::move(ready)});
+    }
+    m_Condition.notify_one();
+}
+
+void OpenGLResourceLoader::LoaderLoop() {
+    glfwMakeContextCurrent(m_LoaderWindow);
+
+    // NOTE: The render thread deletes buffers whose names this context may still have bound,
+    // a recycled name would look bound already. Loads are few binds, nothing worth caching.
+    OpenGLStateCache::Get().SetBypass(true);
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [this]() {
+                return m_Stopping || !m_Jobs.empty();
+            });
+
+            // NOTE: Jobs still queued at shutdown are dropped, nobody is left to use them
+            if (m_Stopping) {
+                break;
+            }
+
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+
+        LoadedJob loaded;
+        {
+            PROFILE_SCOPE("OpenGLResourceLoader::Load");
+            loaded.loaded = RunLoad(job.load);
+        }
+        loaded.ready = std::move(job.ready);
+
+        // NOTE: The flush makes sure the fence reaches the GPU, the render thread only polls it
+        if (loaded.loaded) {
+            loaded.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Loaded.push_back(std::move(loaded));
+    }
+
+    glfwMakeContextCurrent(nullptr);
+}
+
+void OpenGLResourceLoader::Poll() {
+    PROFILE_SCOPE("OpenGLResourceLoader::Poll");
+
+    std::deque<LoadedJob> finished;
+    if (m_LoaderWindow) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        while (!m_Loaded.empty()) {
+            LoadedJob& job = m_Loaded.front();
+            if (job.fence) {
+                GLenum result = glClientWaitSync(job.fence, 0, 0);
+                if (result == GL_TIMEOUT_EXPIRED) {
+                    break;
+                }
+                if (result == GL_WAIT_FAILED) {
+                    Log::Error("Waiting on resource loader fence failed");
+                }
+                glDeleteSync(job.fence);
+                job.fence = nullptr;
+            }
+
+            finished.push_back(std::move(job));
+            m_Loaded.pop_front();
+        }
+    } else {
+        std::deque<Job> jobs;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            jobs.swap(m_Jobs);
+        }
+        for (Job& job : jobs) {
+            finished.push_back(LoadedJob{nullptr, std::move(job.ready), RunLoad(job.load)});
+        }
+    }
+
+    // NOTE: Buffers released on the loader thread free their names there, the names handed
+    // out again to the objects published here may still be bound in this context
+    if (m_LoaderWindow && !finished.empty()) {
+        OpenGLStateCache::Get().InvalidateSharedObjects();
+    }
+
+    // NOTE: Ready callbacks run without the lock so they can submit more jobs
+    for (LoadedJob& job : finished) {
+        m_Pending.fetch_sub(1, std::memory_order_relaxed);
+        if (!job.loaded) {
+            m_Stats.jobsFailed++;
+            continue;
+        }
+
+        m_Stats.jobsLoaded++;
+        job.ready();
+        m_Stats.jobsPublished++;
+    }
+}
+
+} // namespace forge
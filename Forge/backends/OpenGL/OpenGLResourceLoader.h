@@ -0,0 +1,72 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef OPENGLRESOURCELOADER_H
+#define OPENGLRESOURCELOADER_H
+
+#include "Forge/Renderer/ResourceLoader.h"
+#include <glad/glad.h>
+
+#include "GLFW/glfw3.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace forge {
+
+// NOTE: The loader context lives in a hidden 1x1 window sharing objects with the main
+// window and is current on the loader thread only. Each loaded job is followed by a fence
+// and a flush, Poll publishes jobs in submission order once their fence signaled. When the
+// shared context can't be created jobs run on the render thread in Poll instead.
+class OpenGLResourceLoader final : public ResourceLoader {
+public:
+    explicit OpenGLResourceLoader(const Shared<Window>& window);
+    ~OpenGLResourceLoader() override;
+
+    void Poll() override;
+
+    [[nodiscard]] uint32_t GetPendingCount() const noexcept override {
+        return m_Pending.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] const ResourceLoaderStats& GetStats() const noexcept override {
+        return m_Stats;
+    }
+
+protected:
+    void Enqueue(LoadFn load, ReadyFn ready) override;
+
+private:
+    struct Job {
+        LoadFn load;
+        ReadyFn ready;
+    };
+
+    struct LoadedJob {
+        GLsync fence{nullptr};
+        ReadyFn ready;
+        bool loaded{false};
+    };
+
+    void LoaderLoop();
+    [[nodiscard]] static bool RunLoad(const LoadFn& load);
+
+    GLFWwindow* m_LoaderWindow{nullptr};
+    std::thread m_Thread;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<Job> m_Jobs;
+    std::deque<LoadedJob> m_Loaded;
+    bool m_Stopping{false};
+
+    std::atomic<uint32_t> m_Pending{0};
+    // NOTE: Only touched by the render thread
+    ResourceLoaderStats m_Stats;
+};
+
+} // namespace forge
+
+#endif
@@ -2,12 +2,13 @@
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 
 #include "OpenGLShader.h"
+#include "OpenGLStateCache.h"
 #include "Forge/Renderer/Shader.h"
+#include "Forge/Utils/Hash.h"
 #include "Forge/Utils/Log.h"
 
-#include <cstdlib>
-#include <fstream>
 #include <glad/glad.h>
+#include <string_view>
 
 #include "spirv_cross/spirv.hpp"
 #include "spirv_cross/spirv_glsl.hpp"
@@ -35,250 +36,246 @@ namespace forge {
     }
 }
 
-OpenGLShader::OpenGLShader(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV) noexcept {
-    std::vector<unsigned int> shaderIDs;
-    shaderIDs.reserve(shaderSPIRV.size());
+// NOTE: GL_KHR_parallel_shader_compile is not part of the generated glad loader
+#ifndef GL_COMPLETION_STATUS_KHR
+#    define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+static bool IsParallelCompileSupported() {
+    static const bool s_Supported = []() {
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        for (GLint i = 0; i < extensionCount; i++) {
+            std::string_view extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+            if (extension == "GL_KHR_parallel_shader_compile" || extension == "GL_ARB_parallel_shader_compile") {
+                Log::Info("Using {} for asynchronous program linking", extension);
+                return true;
+            }
+        }
+        return false;
+    }();
+    return s_Supported;
+}
 
-    for (auto& [type, spirv_binary] : shaderSPIRV) {
-        ReflectShaderResources(spirv_binary, type);
+OpenGLShader::OpenGLShader(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV) noexcept
+    : OpenGLShader(Translate(shaderSPIRV), false) {}
+
+OpenGLShader::OpenGLShader(OpenGLShaderSource&& source, bool deferLink) noexcept
+    : m_ProgramKey(source.programKey)
+    , m_Reflection(std::move(source.reflection)) {
+    BeginBuild(source);
 
-        spirv_cross::CompilerGLSL glsl(std::move(spirv_binary));
+    if (!deferLink) {
+        FinishBuild();
+    }
+}
 
-        spirv_cross::CompilerGLSL::Options options;
-        options.version = 450;
-        options.es = false;
-        glsl.set_common_options(options);
+OpenGLShaderSource OpenGLShader::Translate(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV) {
+    OpenGLShaderSource source;
+
+    // NOTE: A cached program binary makes the GLSL translation unnecessary, only reflect
+    auto& programCache = OpenGLProgramCache::Get();
+    if (programCache.IsEnabled()) {
+        source.programKey = programCache.MakeKey(shaderSPIRV);
+        source.programBinary = programCache.Load(source.programKey);
+        if (source.programBinary) {
+            for (const auto& [type, spirv_binary] : shaderSPIRV) {
+                source.reflection.Reflect(spirv_binary, type);
+            }
+            source.spirv = std::move(shaderSPIRV);
+            return source;
+        }
+    }
 
-        std::string source = glsl.compile();
+    if (!TranslateStages(shaderSPIRV, source, &source.reflection)) {
+        source.stages.clear();
+    }
+    return source;
+}
 
-        unsigned int shaderID = CompileShader(source, ShaderTypeToOpenGL(type));
-        if (shaderID) {
-            shaderIDs.push_back(shaderID);
-        } else {
-            Log::Critical("Failed to compile {} shader", GetShaderTypeName(type));
+bool OpenGLShader::TranslateStages(ShaderSPIRVMap& shaderSPIRV, OpenGLShaderSource& source, ShaderReflection* reflection) {
+    source.stages.reserve(shaderSPIRV.size());
 
-            // Cleanup already compiled shaders
-            for (auto id : shaderIDs) {
-                glDeleteShader(id);
+    for (auto& [type, spirv_binary] : shaderSPIRV) {
+        try {
+            spirv_cross::CompilerGLSL glsl(std::move(spirv_binary));
+            if (reflection) {
+                reflection->Reflect(glsl, type);
             }
-            return;
+
+            spirv_cross::CompilerGLSL::Options options;
+            options.version = 450;
+            options.es = false;
+            glsl.set_common_options(options);
+
+            source.stages.emplace_back(type, glsl.compile());
+        } catch (const spirv_cross::CompilerError& e) {
+            Log::Critical("Failed to translate {} shader: {}", GetShaderTypeName(type), e.what());
+            return false;
         }
     }
 
-    // Link the shader program
-    m_ProgramID = LinkShaders(shaderIDs);
-    if (!m_ProgramID) {
-        Log::Critical("Failed to link shader program");
-    }
+    return true;
 }
 
 OpenGLShader::~OpenGLShader() {
+    for (unsigned int shaderID : m_PendingShaderIDs) {
+        glDeleteShader(shaderID);
+    }
+
     if (m_ProgramID) {
+        OpenGLStateCache::Get().OnProgramDeleted(m_ProgramID);
         glDeleteProgram(m_ProgramID);
     }
 }
 
 void OpenGLShader::Bind() const {
     FORGE_ASSERT(m_ProgramID, "Attempting to bind invalid shader program");
-    glUseProgram(m_ProgramID);
+    OpenGLStateCache::Get().UseProgram(m_ProgramID);
 }
 
 void OpenGLShader::UnBind() const {
-    glUseProgram(0);
+    OpenGLStateCache::Get().UseProgram(0);
 }
 
-unsigned int OpenGLShader::CompileShader(const std::string& source, GLenum shaderType) {
-    unsigned int shaderID = glCreateShader(shaderType);
-    const char* src = source.c_str();
-    glShaderSource(shaderID, 1, &src, nullptr);
-    glCompileShader(shaderID);
-
-    int success;
-    glGetShaderiv(shaderID, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        char infoLog[1024];
-        glGetShaderInfoLog(shaderID, 1024, nullptr, infoLog);
-        Log::Critical("Shader compilation failed: {}", std::string(infoLog));
-        glDeleteShader(shaderID);
-        return 0;
+bool OpenGLShader::PollLinkStatus() noexcept {
+    if (!m_LinkPending) {
+        return true;
     }
 
-    return shaderID;
-}
-
-unsigned int OpenGLShader::LinkShaders(const std::vector<unsigned int>& shaderIDs) {
-    if (shaderIDs.empty()) {
-        Log::Critical("No shaders to link");
-        return 0;
+    // NOTE: Without the extension the status query below simply blocks until the driver is done
+    if (IsParallelCompileSupported()) {
+        GLint completed = GL_FALSE;
+        glGetProgramiv(m_ProgramID, GL_COMPLETION_STATUS_KHR, &completed);
+        if (!completed) {
+            return false;
+        }
     }
 
-    unsigned int programID = glCreateProgram();
-
-    for (unsigned int shaderID : shaderIDs) {
-        glAttachShader(programID, shaderID);
-    }
+    FinishBuild();
+    return true;
+}
 
-    glLinkProgram(programID);
+bool OpenGLShader::LoadProgramBinary(const OpenGLProgramBinary& binary) {
+    m_ProgramID = glCreateProgram();
+    glProgramBinary(m_ProgramID, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
 
     int success;
-    glGetProgramiv(programID, GL_LINK_STATUS, &success);
-    if (!success) {
-        char infoLog[1024];
-        glGetProgramInfoLog(programID, 1024, nullptr, infoLog);
-        Log::Critical("Shader program linking failed: {}", std::string(infoLog));
-        glDeleteProgram(programID);
-
-        for (unsigned int shaderID : shaderIDs) {
-            glDeleteShader(shaderID);
-        }
-
-        return 0;
-    }
-
-    // Cleanup individual shaders
-    for (unsigned int shaderID : shaderIDs) {
-        glDetachShader(programID, shaderID);
-        glDeleteShader(shaderID);
+    glGetProgramiv(m_ProgramID, GL_LINK_STATUS, &success);
+    if (success) {
+        return true;
     }
 
-    return programID;
+    glDeleteProgram(m_ProgramID);
+    m_ProgramID = 0;
+    return false;
 }
 
-void OpenGLShader::ReflectShaderResources(const std::vector<uint32_t>& spirv, ShaderType type) {
-    try {
-        spirv_cross::CompilerGLSL glsl(spirv);
-        spirv_cross::ShaderResources resources = glsl.get_shader_resources();
-
-        // Reflect Uniform Buffers
-        for (const auto& resource : resources.uniform_buffers) {
-            ShaderResource ubo{};
-            ubo.binding = glsl.get_decoration(resource.id, spv::DecorationBinding);
-            ubo.set = glsl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            ubo.name = resource.name;
-            ubo.type = ShaderResourceType::UniformBuffer;
-
-            // Get buffer size and member count
-            const auto& bufferType = glsl.get_type(resource.base_type_id);
-            ubo.size = glsl.get_declared_struct_size(bufferType);
-            ubo.memberCount = bufferType.member_types.size();
-
-            m_UniformBuffers.push_back(ubo);
+void OpenGLShader::BeginBuild(OpenGLShaderSource& source) {
+    if (source.programBinary) {
+        if (LoadProgramBinary(*source.programBinary)) {
+            return;
         }
 
-        // Reflect Storage Buffers
-        for (const auto& resource : resources.storage_buffers) {
-            ShaderResource ssbo{};
-            ssbo.binding = glsl.get_decoration(resource.id, spv::DecorationBinding);
-            ssbo.set = glsl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            ssbo.name = resource.name;
-            ssbo.type = ShaderResourceType::StorageBuffer;
-
-            const auto& bufferType = glsl.get_type(resource.base_type_id);
-            ssbo.size = glsl.get_declared_struct_size(bufferType);
-            ssbo.memberCount = bufferType.member_types.size();
-
-            m_StorageBuffers.push_back(ssbo);
+        // NOTE: Drivers reject binaries after an update, rebuild from the SPIR-V and store a new one
+        Log::Warn("Driver rejected cached program binary {}, rebuilding", HashToHex(m_ProgramKey));
+        OpenGLProgramCache::Get().Invalidate(m_ProgramKey);
+        source.programBinary.reset();
+        if (!TranslateStages(source.spirv, source, nullptr)) {
+            source.stages.clear();
         }
+    }
 
-        // Reflect Samplers
-        for (const auto& resource : resources.sampled_images) {
-            ShaderResource sampler{};
-            sampler.binding = glsl.get_decoration(resource.id, spv::DecorationBinding);
-            sampler.set = glsl.get_decoration(resource.id, spv::DecorationDescriptorSet);
-            sampler.name = resource.name;
-            sampler.type = ShaderResourceType::Sampler;
+    if (source.stages.empty()) {
+        Log::Critical("No shaders to link");
+        return;
+    }
 
-            m_Samplers.push_back(sampler);
-        }
+    // NOTE: Status checks are left to FinishBuild so the driver is free to compile and
+    // link in the background when GL_KHR_parallel_shader_compile is available
+    m_PendingShaderIDs.reserve(source.stages.size());
+    for (const auto& [type, glsl] : source.stages) {
+        unsigned int shaderID = glCreateShader(ShaderTypeToOpenGL(type));
+        const char* src = glsl.c_str();
+        glShaderSource(shaderID, 1, &src, nullptr);
+        glCompileShader(shaderID);
+        m_PendingShaderIDs.push_back(shaderID);
+    }
 
-        // Reflect Stage Inputs (vertex attributes for vertex shader)
-        if (type == ShaderType::Vertex) {
-            for (const auto& resource : resources.stage_inputs) {
-                ShaderResource input{};
-                input.location = glsl.get_decoration(resource.id, spv::DecorationLocation);
-                input.name = resource.name;
-                input.type = ShaderResourceType::Input;
+    m_ProgramID = glCreateProgram();
+    if (m_ProgramKey) {
+        glProgramParameteri(m_ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    for (unsigned int shaderID : m_PendingShaderIDs) {
+        glAttachShader(m_ProgramID, shaderID);
+    }
+
+    glLinkProgram(m_ProgramID);
+    m_LinkPending = true;
+}
 
-                const auto& inputType = glsl.get_type(resource.type_id);
-                input.size = inputType.vecsize * sizeof(float); // Assuming float attributes
+void OpenGLShader::FinishBuild() {
+    if (!m_LinkPending) {
+        return;
+    }
+    m_LinkPending = false;
 
-                m_StageInputs.push_back(input);
+    int success;
+    glGetProgramiv(m_ProgramID, GL_LINK_STATUS, &success);
+    if (!success) {
+        char infoLog[1024];
+        for (unsigned int shaderID : m_PendingShaderIDs) {
+            glGetShaderiv(shaderID, GL_COMPILE_STATUS, &success);
+            if (!success) {
+                glGetShaderInfoLog(shaderID, 1024, nullptr, infoLog);
+                Log::Critical("Shader compilation failed: {}", std::string(infoLog));
             }
         }
 
-        // Reflect Stage Outputs
-        for (const auto& resource : resources.stage_outputs) {
-            ShaderResource output{};
-            output.location = glsl.get_decoration(resource.id, spv::DecorationLocation);
-            output.name = resource.name;
-            output.type = ShaderResourceType::Output;
-
-            m_StageOutputs.push_back(output);
+        glGetProgramInfoLog(m_ProgramID, 1024, nullptr, infoLog);
+        Log::Critical("Shader program linking failed: {}", std::string(infoLog));
+        glDeleteProgram(m_ProgramID);
+        m_ProgramID = 0;
+    } else {
+        // Cleanup individual shaders
+        for (unsigned int shaderID : m_PendingShaderIDs) {
+            glDetachShader(m_ProgramID, shaderID);
         }
+    }
 
-    } catch (const spirv_cross::CompilerError& e) {
-        Log::Error("SPIRV-Cross reflection error: {}", e.what());
+    for (unsigned int shaderID : m_PendingShaderIDs) {
+        glDeleteShader(shaderID);
     }
-}
+    m_PendingShaderIDs.clear();
 
-bool OpenGLShader::HasUniformBuffer(const std::string& name) const noexcept {
-    return std::find_if(m_UniformBuffers.begin(), m_UniformBuffers.end(), [&name](const ShaderResource& resource) {
-               return resource.name == name;
-           }) != m_UniformBuffers.end();
+    if (!m_ProgramID) {
+        Log::Critical("Failed to link shader program");
+    } else if (m_ProgramKey) {
+        OpenGLProgramCache::Get().Store(m_ProgramKey, m_ProgramID);
+    }
 }
 
-bool OpenGLShader::HasStorageBuffer(const std::string& name) const noexcept {
-    return std::find_if(m_StorageBuffers.begin(), m_StorageBuffers.end(), [&name](const ShaderResource& resource) {
-               return resource.name == name;
-           }) != m_StorageBuffers.end();
+bool OpenGLShaderBuildTask::Prepare(ShaderSPIRVMap& spirvBinaries) {
+    m_Source = OpenGLShader::Translate(spirvBinaries);
+    return m_Source.IsValid();
 }
 
-bool OpenGLShader::HasSampler(const std::string& name) const noexcept {
-    return std::find_if(m_Samplers.begin(), m_Samplers.end(), [&name](const ShaderResource& resource) {
-               return resource.name == name;
-           }) != m_Samplers.end();
-}
+ShaderBuildStatus OpenGLShaderBuildTask::Poll(Shared<Shader>& outShader) {
+    if (!m_Shader) {
+        m_Shader = CreateShared<OpenGLShader>(std::move(m_Source), true);
+    }
 
-const ShaderResource* OpenGLShader::FindResource(const std::string& name) const noexcept {
-    // Search in all resource collections
-    auto findInCollection = [&name](const std::vector<ShaderResource>& collection) {
-        auto it = std::find_if(collection.begin(), collection.end(), [&name](const ShaderResource& resource) {
-            return resource.name == name;
-        });
-        return it != collection.end() ? &(*it) : nullptr;
-    };
-
-    if (auto* resource = findInCollection(m_UniformBuffers))
-        return resource;
-    if (auto* resource = findInCollection(m_StorageBuffers))
-        return resource;
-    if (auto* resource = findInCollection(m_Samplers))
-        return resource;
-    if (auto* resource = findInCollection(m_StageInputs))
-        return resource;
-    if (auto* resource = findInCollection(m_StageOutputs))
-        return resource;
-
-    return nullptr;
-}
+    if (!m_Shader->PollLinkStatus()) {
+        return ShaderBuildStatus::Pending;
+    }
+
+    if (!m_Shader->GetProgramID()) {
+        m_Shader.reset();
+        return ShaderBuildStatus::Failed;
+    }
 
-const ShaderResource* OpenGLShader::FindResourceByBinding(uint32_t binding, uint32_t set) const noexcept {
-    // Search in resources that can have bindings
-    auto findInCollection = [binding, set](const std::vector<ShaderResource>& collection) {
-        auto it = std::find_if(collection.begin(), collection.end(), [binding, set](const ShaderResource& resource) {
-            return resource.binding == binding && resource.set == set;
-        });
-        return it != collection.end() ? &(*it) : nullptr;
-    };
-
-    if (auto* resource = findInCollection(m_UniformBuffers))
-        return resource;
-    if (auto* resource = findInCollection(m_StorageBuffers))
-        return resource;
-    if (auto* resource = findInCollection(m_Samplers))
-        return resource;
-
-    return nullptr;
+    outShader = std::move(m_Shader);
+    return ShaderBuildStatus::Ready;
 }
 
 } // namespace forge
@@ -5,17 +5,48 @@
 #define OPENGLSHADER_H
 
 #include "Forge/Renderer/Shader.h"
+#include "Forge/Renderer/Shader/AsyncShader.h"
+#include "Forge/Renderer/Shader/ShaderReflection.h"
+#include "OpenGLProgramCache.h"
 #include <glad/glad.h>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace forge {
 
+// NOTE: Output of the CPU side of shader construction (reflection and SPIRV-Cross
+// translation), safe to produce on any thread
+struct OpenGLShaderSource {
+    std::vector<std::pair<ShaderType, std::string>> stages;
+    ShaderReflection reflection;
+
+    // NOTE: On a program cache hit the stages are not translated, the SPIR-V is kept
+    // in case the driver rejects the binary
+    uint64_t programKey{0};
+    std::optional<OpenGLProgramBinary> programBinary;
+    ShaderSPIRVMap spirv;
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return !stages.empty() || programBinary.has_value();
+    }
+};
+
 class OpenGLShader final : public Shader {
 public:
     explicit OpenGLShader(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV) noexcept;
+    // NOTE: With deferLink the driver compile and link are only started, call
+    // PollLinkStatus on the context thread until it returns true
+    OpenGLShader(OpenGLShaderSource&& source, bool deferLink) noexcept;
     ~OpenGLShader() override;
 
+    [[nodiscard]] static OpenGLShaderSource Translate(std::unordered_map<ShaderType, std::vector<uint32_t>>& shaderSPIRV);
+
+    // Returns true once linking finished, GetProgramID is 0 if it failed
+    bool PollLinkStatus() noexcept;
+
     OpenGLShader(const OpenGLShader&) = delete;
     OpenGLShader& operator=(const OpenGLShader&) = delete;
 
@@ -27,48 +58,71 @@ public:
 
     // Reflection interface
     [[nodiscard]] const std::vector<ShaderResource>& GetUniformBuffers() const noexcept override {
-        return m_UniformBuffers;
+        return m_Reflection.GetUniformBuffers();
     }
     [[nodiscard]] const std::vector<ShaderResource>& GetStorageBuffers() const noexcept override {
-        return m_StorageBuffers;
+        return m_Reflection.GetStorageBuffers();
     }
     [[nodiscard]] const std::vector<ShaderResource>& GetSamplers() const noexcept override {
-        return m_Samplers;
+        return m_Reflection.GetSamplers();
     }
     [[nodiscard]] const std::vector<ShaderResource>& GetStageInputs() const noexcept override {
-        return m_StageInputs;
+        return m_Reflection.GetStageInputs();
     }
     [[nodiscard]] const std::vector<ShaderResource>& GetStageOutputs() const noexcept override {
-        return m_StageOutputs;
+        return m_Reflection.GetStageOutputs();
     }
 
-    [[nodiscard]] bool HasUniformBuffer(const std::string& name) const noexcept override;
-    [[nodiscard]] bool HasStorageBuffer(const std::string& name) const noexcept override;
-    [[nodiscard]] bool HasSampler(const std::string& name) const noexcept override;
+    [[nodiscard]] bool HasUniformBuffer(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.HasUniformBuffer(name);
+    }
+    [[nodiscard]] bool HasStorageBuffer(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.HasStorageBuffer(name);
+    }
+    [[nodiscard]] bool HasSampler(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.HasSampler(name);
+    }
 
-    [[nodiscard]] const ShaderResource* FindResource(const std::string& name) const noexcept override;
-    [[nodiscard]] const ShaderResource* FindResourceByBinding(uint32_t binding, uint32_t set = 0) const noexcept override;
+    [[nodiscard]] const ShaderResource* FindResource(ShaderResourceKey name) const noexcept override {
+        return m_Reflection.FindResource(name);
+    }
+    [[nodiscard]] const ShaderResource* FindResourceByBinding(uint32_t binding, uint32_t set = 0) const noexcept override {
+        return m_Reflection.FindResourceByBinding(binding, set);
+    }
 
     [[nodiscard]] inline unsigned int GetProgramID() const noexcept {
         return m_ProgramID;
     }
 
 private:
-    [[nodiscard]] unsigned int CompileShader(const std::string& source, GLenum shaderType);
-    [[nodiscard]] unsigned int LinkShaders(const std::vector<unsigned int>& shaderIDs);
-    void CleanupShaders(const std::vector<unsigned int>& shaderIDs);
+    // NOTE: Parses each stage once, reflects into reflection when given and emits GLSL
+    [[nodiscard]] static bool TranslateStages(ShaderSPIRVMap& shaderSPIRV, OpenGLShaderSource& source,
+                                              ShaderReflection* reflection);
+    [[nodiscard]] bool LoadProgramBinary(const OpenGLProgramBinary& binary);
+    void BeginBuild(OpenGLShaderSource& source);
+    void FinishBuild();
     [[nodiscard]] static GLenum ShaderTypeToOpenGL(ShaderType type) noexcept;
-    void ReflectShaderResources(const std::vector<uint32_t>& spirv, ShaderType type);
 
 private:
     unsigned int m_ProgramID{0};
+    std::vector<unsigned int> m_PendingShaderIDs;
+    bool m_LinkPending{false};
+    uint64_t m_ProgramKey{0};
 
     // Reflected resources
-    std::vector<ShaderResource> m_UniformBuffers;
-    std::vector<ShaderResource> m_Samplers;
-    std::vector<ShaderResource> m_StorageBuffers;
-    std::vector<ShaderResource> m_StageInputs;
-    std::vector<ShaderResource> m_StageOutputs;
+    ShaderReflection m_Reflection;
+};
+
+// NOTE: Translation runs on the worker, the driver compile and link are started on the
+// first poll and finished once the driver reports completion
+class OpenGLShaderBuildTask final : public ShaderBuildTask {
+public:
+    [[nodiscard]] bool Prepare(ShaderSPIRVMap& spirvBinaries) override;
+    [[nodiscard]] ShaderBuildStatus Poll(Shared<Shader>& outShader) override;
+
+private:
+    OpenGLShaderSource m_Source;
+    Shared<OpenGLShader> m_Shader;
 };
 
 } // namespace forge
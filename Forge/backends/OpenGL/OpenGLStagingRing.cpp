@@ -0,0 +1,171 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "OpenGLStagingRing.h"
+#include "OpenGLBufferStorage.h"
+#include "Forge/Utils/Common.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace forge {
+
+OpenGLStagingRing& OpenGLStagingRing::Get() {
+    static OpenGLStagingRing s_Ring;
+    return s_Ring;
+}
+
+void OpenGLStagingRing::Init(uint32_t capacity) {
+    FORGE_ASSERT(!m_Buffer, "Staging ring initialized twice");
+
+    m_Capacity = capacity / ALIGNMENT * ALIGNMENT;
+    m_OwnerThread = std::this_thread::get_id();
+    m_Buffer = CreateOpenGLBuffer();
+    m_MappedData = static_cast<uint8_t*>(CreatePersistentOpenGLBuffer(m_Buffer, m_Capacity));
+
+    FORGE_ASSERT(m_MappedData, "Failed to persistently map the staging ring");
+}
+
+void OpenGLStagingRing::Shutdown() {
+    for (FencedBytes& fenced : m_Fences) {
+        glDeleteSync(fenced.fence);
+    }
+    m_Fences.clear();
+
+    if (m_Buffer) {
+        if (m_MappedData) {
+            UnmapOpenGLBuffer(m_Buffer);
+        }
+        DeleteOpenGLBuffer(m_Buffer);
+    }
+
+    Log::Info("Staging ring: {} bytes streamed in {} copies, {} stalls", m_Stats.bytesStreamed, m_Stats.copies, m_Stats.stalls);
+
+    m_Buffer = 0;
+    m_MappedData = nullptr;
+    m_Head = 0;
+    m_Used = 0;
+    m_Unfenced = 0;
+    m_Stats = {};
+}
+
+void OpenGLStagingRing::Retire(bool wait) {
+    while (!m_Fences.empty()) {
+        FencedBytes& oldest = m_Fences.front();
+
+        GLenum result = glClientWaitSync(oldest.fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            if (!wait) {
+                return;
+            }
+
+            PROFILE_SCOPE("OpenGLStagingRing::Stall");
+            m_Stats.stalls++;
+            while (result == GL_TIMEOUT_EXPIRED) {
+                result = glClientWaitSync(oldest.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+            }
+        }
+        if (result == GL_WAIT_FAILED) {
+            Log::Error("Waiting on staging ring fence failed");
+        }
+
+        glDeleteSync(oldest.fence);
+        m_Used -= oldest.size;
+        m_Fences.pop_front();
+
+        // NOTE: One retired fence is enough when waiting, the caller checks for space again
+        if (wait) {
+            return;
+        }
+    }
+}
+
+OpenGLStagingAllocation OpenGLStagingRing::Allocate(uint32_t size) {
+    FORGE_ASSERT(std::this_thread::get_id() == m_OwnerThread, "Staging ring used off the render thread");
+    size = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if (!m_MappedData || size == 0 || size > m_Capacity) {
+        return {};
+    }
+
+    Retire(false);
+
+    while (true) {
+        if (m_Used == 0) {
+            m_Head = 0;
+        }
+
+        // NOTE: The oldest unreleased byte, free space runs from the head up to it
+        uint32_t tail = (m_Head + m_Capacity - m_Used % m_Capacity) % m_Capacity;
+        bool wrapped = m_Used > 0 && m_Head <= tail;
+
+        if (!wrapped && m_Used < m_Capacity) {
+            if (m_Head + size <= m_Capacity) {
+                break;
+            }
+            // Skip the end of the ring when the front has room
+            if (size <= tail) {
+                uint32_t padding = m_Capacity - m_Head;
+                m_Used += padding;
+                m_Unfenced += padding;
+                m_Head = 0;
+                continue;
+            }
+        } else if (wrapped && m_Used < m_Capacity && m_Head + size <= tail) {
+            break;
+        }
+
+        // NOTE: Out of space, everything in flight belongs to the GPU. Fence what is still
+        // unfenced so there is something to wait on.
+        if (m_Fences.empty()) {
+            Fence();
+        }
+        Retire(true);
+    }
+
+    OpenGLStagingAllocation allocation{m_MappedData + m_Head, m_Head, size};
+    m_Head += size;
+    m_Used += size;
+    m_Unfenced += size;
+    return allocation;
+}
+
+void OpenGLStagingRing::Copy(const OpenGLStagingAllocation& allocation, GLuint destination, uint32_t offset) {
+    FORGE_ASSERT(allocation.IsValid(), "Copying an invalid staging allocation");
+
+    CopyOpenGLBuffer(m_Buffer, destination, allocation.offset, offset, allocation.size);
+
+    m_Stats.bytesStreamed += allocation.size;
+    m_Stats.copies++;
+}
+
+void OpenGLStagingRing::Upload(GLuint destination, const void* data, uint32_t size, uint32_t offset) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+
+    // NOTE: Chunks of a quarter ring keep a large upload from waiting on the whole ring
+    uint32_t chunkSize = std::max(m_Capacity / 4, ALIGNMENT);
+    for (uint32_t written = 0; written < size;) {
+        uint32_t chunk = std::min(chunkSize, size - written);
+
+        OpenGLStagingAllocation allocation = Allocate(chunk);
+        FORGE_ASSERT(allocation.IsValid(), "Staging ring allocation failed");
+        std::memcpy(allocation.data, bytes + written, chunk);
+
+        // NOTE: The allocation is padded to the ring alignment, only the data itself is copied
+        allocation.size = chunk;
+        Copy(allocation, destination, offset + written);
+        written += chunk;
+    }
+}
+
+void OpenGLStagingRing::Fence() {
+    if (m_Unfenced == 0) {
+        return;
+    }
+
+    m_Fences.push_back(FencedBytes{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_Unfenced});
+    m_Unfenced = 0;
+}
+
+} // namespace forge
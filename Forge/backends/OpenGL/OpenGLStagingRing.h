@@ -0,0 +1,89 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef OPENGLSTAGINGRING_H
+#define OPENGLSTAGINGRING_H
+
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <glad/glad.h>
+
+namespace forge {
+
+struct OpenGLStagingAllocation {
+    uint8_t* data{nullptr};
+    uint32_t offset{0};
+    uint32_t size{0};
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return data != nullptr;
+    }
+};
+
+struct OpenGLStagingStats {
+    uint64_t bytesStreamed{0};
+    uint64_t copies{0};
+    uint64_t stalls{0};
+};
+
+// NOTE: Persistently mapped upload ring used by BufferDrawMode::Stream buffers. Producers
+// write into mapped memory and the data reaches the destination buffer through
+// glCopyBufferSubData, which the GPU orders with the draws around it, so nothing waits on
+// the GPU the way glBufferSubData on a buffer in use does. Space is handed back when the
+// fence placed after its copies signals; the CPU only blocks when it is a whole ring ahead.
+class OpenGLStagingRing {
+public:
+    static constexpr uint32_t DEFAULT_CAPACITY = 32 * 1024 * 1024;
+
+    static OpenGLStagingRing& Get();
+
+    // NOTE: Called by the context once it is current and before it is destroyed
+    void Init(uint32_t capacity = DEFAULT_CAPACITY);
+    void Shutdown();
+
+    [[nodiscard]] OpenGLStagingAllocation Allocate(uint32_t size);
+    // NOTE: Copies the allocation into the destination buffer at the given offset
+    void Copy(const OpenGLStagingAllocation& allocation, GLuint destination, uint32_t offset);
+    // Allocate, fill and copy, split into chunks when the data does not fit the ring at once
+    void Upload(GLuint destination, const void* data, uint32_t size, uint32_t offset);
+
+    // NOTE: Fences the copies issued since the last call, done once per frame
+    void Fence();
+
+    [[nodiscard]] uint32_t GetCapacity() const noexcept {
+        return m_Capacity;
+    }
+    [[nodiscard]] const OpenGLStagingStats& GetStats() const noexcept {
+        return m_Stats;
+    }
+
+private:
+    OpenGLStagingRing() = default;
+
+    static constexpr uint32_t ALIGNMENT = 16;
+
+    struct FencedBytes {
+        GLsync fence{nullptr};
+        uint32_t size{0};
+    };
+
+    void Retire(bool wait);
+
+    GLuint m_Buffer{0};
+    uint8_t* m_MappedData{nullptr};
+    // NOTE: The ring is not synchronized, only the thread that initialized it may use it
+    std::thread::id m_OwnerThread;
+    uint32_t m_Capacity{0};
+    uint32_t m_Head{0};
+    // Bytes between the oldest unreleased byte and the head, padding at the wrap included
+    uint32_t m_Used{0};
+    uint32_t m_Unfenced{0};
+    std::deque<FencedBytes> m_Fences;
+
+    OpenGLStagingStats m_Stats;
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,248 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "OpenGLStateCache.h"
+
+namespace forge {
+
+OpenGLStateCache& OpenGLStateCache::Get() {
+    thread_local OpenGLStateCache s_Cache;
+    return s_Cache;
+}
+
+OpenGLStateCache::OpenGLStateCache() {
+    Invalidate();
+}
+
+bool OpenGLStateCache::Elide(bool unchanged) noexcept {
+    if (unchanged && !m_Bypass) {
+        m_Stats.elided++;
+        return true;
+    }
+    m_Stats.issued++;
+    return false;
+}
+
+int OpenGLStateCache::GetBufferTargetIndex(GLenum target) noexcept {
+    switch (target) {
+    case GL_ARRAY_BUFFER:
+        return static_cast<int>(BufferTarget::Array);
+    case GL_ELEMENT_ARRAY_BUFFER:
+        return static_cast<int>(BufferTarget::ElementArray);
+    case GL_UNIFORM_BUFFER:
+        return static_cast<int>(BufferTarget::Uniform);
+    case GL_SHADER_STORAGE_BUFFER:
+        return static_cast<int>(BufferTarget::ShaderStorage);
+    case GL_DRAW_INDIRECT_BUFFER:
+        return static_cast<int>(BufferTarget::DrawIndirect);
+    case GL_COPY_READ_BUFFER:
+        return static_cast<int>(BufferTarget::CopyRead);
+    case GL_COPY_WRITE_BUFFER:
+        return static_cast<int>(BufferTarget::CopyWrite);
+    default:
+        return -1;
+    }
+}
+
+int OpenGLStateCache::GetCapabilityIndex(GLenum capability) noexcept {
+    switch (capability) {
+    case GL_DEPTH_TEST:
+        return static_cast<int>(Capability::DepthTest);
+    case GL_CULL_FACE:
+        return static_cast<int>(Capability::CullFace);
+    case GL_BLEND:
+        return static_cast<int>(Capability::Blend);
+    default:
+        return -1;
+    }
+}
+
+void OpenGLStateCache::UseProgram(GLuint program) {
+    if (Elide(m_Program == program)) {
+        return;
+    }
+    glUseProgram(program);
+    m_Program = program;
+}
+
+void OpenGLStateCache::BindVertexArray(GLuint vertexArray) {
+    if (Elide(m_VertexArray == vertexArray)) {
+        return;
+    }
+    glBindVertexArray(vertexArray);
+    m_VertexArray = vertexArray;
+
+    // NOTE: The element array binding is part of the vertex array state
+    m_Buffers[static_cast<std::size_t>(BufferTarget::ElementArray)] = UNKNOWN;
+}
+
+void OpenGLStateCache::BindBuffer(GLenum target, GLuint buffer) {
+    int index = GetBufferTargetIndex(target);
+    if (index >= 0 && Elide(m_Buffers[index] == buffer)) {
+        return;
+    }
+    if (index < 0) {
+        m_Stats.issued++;
+    }
+
+    glBindBuffer(target, buffer);
+    if (index >= 0) {
+        m_Buffers[index] = buffer;
+    }
+}
+
+void OpenGLStateCache::BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    IndexedBinding* binding = nullptr;
+    if (index < MAX_INDEXED_BINDINGS) {
+        if (target == GL_UNIFORM_BUFFER) {
+            binding = &m_UniformBindings[index];
+        } else if (target == GL_SHADER_STORAGE_BUFFER) {
+            binding = &m_StorageBindings[index];
+        }
+    }
+
+    if (binding && Elide(binding->buffer == buffer && binding->offset == offset && binding->size == size)) {
+        return;
+    }
+    if (!binding) {
+        m_Stats.issued++;
+    }
+
+    glBindBufferRange(target, index, buffer, offset, size);
+    if (binding) {
+        *binding = IndexedBinding{buffer, offset, size};
+    }
+
+    // NOTE: Indexed binds also replace the generic binding of the target
+    int targetIndex = GetBufferTargetIndex(target);
+    if (targetIndex >= 0) {
+        m_Buffers[targetIndex] = buffer;
+    }
+}
+
+void OpenGLStateCache::SetCapability(GLenum capability, bool enabled) {
+    int index = GetCapabilityIndex(capability);
+    GLuint value = enabled ? 1 : 0;
+    if (index >= 0 && Elide(m_Capabilities[index] == value)) {
+        return;
+    }
+    if (index < 0) {
+        m_Stats.issued++;
+    }
+
+    if (enabled) {
+        glEnable(capability);
+    } else {
+        glDisable(capability);
+    }
+    if (index >= 0) {
+        m_Capabilities[index] = value;
+    }
+}
+
+void OpenGLStateCache::DepthFunc(GLenum function) {
+    if (Elide(m_DepthFunc == function)) {
+        return;
+    }
+    glDepthFunc(function);
+    m_DepthFunc = function;
+}
+
+void OpenGLStateCache::CullFace(GLenum mode) {
+    if (Elide(m_CullFace == mode)) {
+        return;
+    }
+    glCullFace(mode);
+    m_CullFace = mode;
+}
+
+void OpenGLStateCache::FrontFace(GLenum mode) {
+    if (Elide(m_FrontFace == mode)) {
+        return;
+    }
+    glFrontFace(mode);
+    m_FrontFace = mode;
+}
+
+void OpenGLStateCache::BlendFunc(GLenum source, GLenum destination) {
+    if (Elide(m_BlendFunc[0] == source && m_BlendFunc[1] == destination)) {
+        return;
+    }
+    glBlendFunc(source, destination);
+    m_BlendFunc = {source, destination};
+}
+
+void OpenGLStateCache::ClearColor(float r, float g, float b, float a) {
+    std::array<float, 4> color{r, g, b, a};
+    if (Elide(m_ClearColor == color)) {
+        return;
+    }
+    glClearColor(r, g, b, a);
+    m_ClearColor = color;
+}
+
+void OpenGLStateCache::ClearDepth(double depth) {
+    if (Elide(m_ClearDepth == depth)) {
+        return;
+    }
+    glClearDepth(depth);
+    m_ClearDepth = depth;
+}
+
+void OpenGLStateCache::ClearStencil(GLint stencil) {
+    if (Elide(m_ClearStencil == stencil)) {
+        return;
+    }
+    glClearStencil(stencil);
+    m_ClearStencil = stencil;
+}
+
+void OpenGLStateCache::OnProgramDeleted(GLuint program) {
+    if (m_Program == program) {
+        m_Program = UNKNOWN;
+    }
+}
+
+void OpenGLStateCache::OnVertexArrayDeleted(GLuint vertexArray) {
+    if (m_VertexArray == vertexArray) {
+        m_VertexArray = UNKNOWN;
+        m_Buffers[static_cast<std::size_t>(BufferTarget::ElementArray)] = UNKNOWN;
+    }
+}
+
+void OpenGLStateCache::OnBufferDeleted(GLuint buffer) {
+    for (GLuint& bound : m_Buffers) {
+        if (bound == buffer) {
+            bound = UNKNOWN;
+        }
+    }
+    for (auto* bindings : {&m_UniformBindings, &m_StorageBindings}) {
+        for (IndexedBinding& binding : *bindings) {
+            if (binding.buffer == buffer) {
+                binding = {};
+            }
+        }
+    }
+}
+
+void OpenGLStateCache::InvalidateSharedObjects() {
+    m_Program = UNKNOWN;
+    m_Buffers.fill(UNKNOWN);
+    m_UniformBindings.fill({});
+    m_StorageBindings.fill({});
+}
+
+void OpenGLStateCache::Invalidate() {
+    InvalidateSharedObjects();
+    m_VertexArray = UNKNOWN;
+    m_Capabilities.fill(UNKNOWN);
+    m_DepthFunc = UNKNOWN;
+    m_CullFace = UNKNOWN;
+    m_FrontFace = UNKNOWN;
+    m_BlendFunc = {UNKNOWN, UNKNOWN};
+    m_ClearColor = {-1.0f, -1.0f, -1.0f, -1.0f};
+    m_ClearDepth = -1.0;
+    m_ClearStencil = -1;
+}
+
+} // namespace forge
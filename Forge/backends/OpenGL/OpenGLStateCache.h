@@ -0,0 +1,109 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef OPENGLSTATECACHE_H
+#define OPENGLSTATECACHE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <glad/glad.h>
+
+namespace forge {
+
+struct OpenGLStateCacheStats {
+    uint64_t issued{0};
+    uint64_t elided{0};
+};
+
+// NOTE: Shadow of the GL state the backend touches. Every setter compares against the last
+// value it issued and skips the call when nothing changes. GL state belongs to the context
+// and a context is current on one thread, so there is one cache per thread. Code that
+// changes state behind its back has to call Invalidate.
+//
+// Buffer and program names are shared between contexts though. When another context deletes
+// one, this context keeps its binding to the dead object while the name gets recycled, and a
+// cached bind of the new object would be skipped. Threads with a second context bypass the
+// cache, the render thread forgets its shared bindings when it picks up their objects.
+class OpenGLStateCache {
+public:
+    static OpenGLStateCache& Get();
+
+    void UseProgram(GLuint program);
+    void BindVertexArray(GLuint vertexArray);
+    void BindBuffer(GLenum target, GLuint buffer);
+    void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+    void SetCapability(GLenum capability, bool enabled);
+    void DepthFunc(GLenum function);
+    void CullFace(GLenum mode);
+    void FrontFace(GLenum mode);
+    void BlendFunc(GLenum source, GLenum destination);
+
+    void ClearColor(float r, float g, float b, float a);
+    void ClearDepth(double depth);
+    void ClearStencil(GLint stencil);
+
+    // NOTE: Names are recycled by the driver, forget them when the object is deleted
+    void OnProgramDeleted(GLuint program);
+    void OnVertexArrayDeleted(GLuint vertexArray);
+    void OnBufferDeleted(GLuint buffer);
+
+    void Invalidate();
+    void InvalidateSharedObjects();
+
+    // NOTE: Every call is issued, the shadow is still kept up to date
+    void SetBypass(bool bypass) noexcept {
+        m_Bypass = bypass;
+    }
+
+    [[nodiscard]] const OpenGLStateCacheStats& GetStats() const noexcept {
+        return m_Stats;
+    }
+    void ResetStats() noexcept {
+        m_Stats = {};
+    }
+
+private:
+    OpenGLStateCache();
+
+    static constexpr GLuint UNKNOWN = 0xFFFFFFFF;
+    static constexpr uint32_t MAX_INDEXED_BINDINGS = 16;
+
+    enum class Capability : uint8_t { DepthTest, CullFace, Blend, Count };
+    enum class BufferTarget : uint8_t { Array, ElementArray, Uniform, ShaderStorage, DrawIndirect, CopyRead, CopyWrite, Count };
+
+    struct IndexedBinding {
+        GLuint buffer{UNKNOWN};
+        GLintptr offset{0};
+        GLsizeiptr size{0};
+    };
+
+    [[nodiscard]] static int GetBufferTargetIndex(GLenum target) noexcept;
+    [[nodiscard]] static int GetCapabilityIndex(GLenum capability) noexcept;
+    [[nodiscard]] bool Elide(bool unchanged) noexcept;
+
+    GLuint m_Program{UNKNOWN};
+    GLuint m_VertexArray{UNKNOWN};
+    std::array<GLuint, static_cast<std::size_t>(BufferTarget::Count)> m_Buffers;
+    std::array<IndexedBinding, MAX_INDEXED_BINDINGS> m_UniformBindings;
+    std::array<IndexedBinding, MAX_INDEXED_BINDINGS> m_StorageBindings;
+
+    // 0 disabled, 1 enabled, UNKNOWN not issued yet
+    std::array<GLuint, static_cast<std::size_t>(Capability::Count)> m_Capabilities;
+    GLenum m_DepthFunc{UNKNOWN};
+    GLenum m_CullFace{UNKNOWN};
+    GLenum m_FrontFace{UNKNOWN};
+    std::array<GLenum, 2> m_BlendFunc{UNKNOWN, UNKNOWN};
+
+    std::array<float, 4> m_ClearColor{-1.0f, -1.0f, -1.0f, -1.0f};
+    double m_ClearDepth{-1.0};
+    GLint m_ClearStencil{-1};
+
+    OpenGLStateCacheStats m_Stats;
+    bool m_Bypass{false};
+};
+
+} // namespace forge
+
+#endif
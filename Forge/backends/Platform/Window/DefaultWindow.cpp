@@ -36,62 +36,77 @@ DefaultWindow::~DefaultWindow() {
 
 void DefaultWindow::Update() {
     glfwPollEvents();
+    DispatchEvents();
 }
+
+void DefaultWindow::WaitEvents(double timeout) {
+    glfwWaitEventsTimeout(timeout);
+    DispatchEvents();
+}
+
 void DefaultWindow::EnableVSync(bool enable) {
     if (enable) {
-        glfwSwapInterval(1);
+        // NOTE: Adaptive vsync tears a late frame instead of waiting a whole extra interval
+        bool adaptive = glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+        glfwSwapInterval(adaptive ? -1 : 1);
     } else {
         glfwSwapInterval(0);
     }
+    m_Data.vsyncEnabled = enable;
+}
+
+void DefaultWindow::DispatchEvents() {
+    ProcessEvents(m_Data.events, [this](const EventRecord& record) {
+        if (record.type == EventType::Drop) {
+            if (m_Data.eventCallback) {
+                DropEvent event(std::move(m_Data.droppedFiles[record.code]), record.action);
+                m_Data.eventCallback(event);
+            }
+            return;
+        }
+        SendEvent(record, m_Data.eventCallback);
+    });
+    m_Data.droppedFiles.clear();
 }
 
 void DefaultWindow::SetCallBackEvents() {
-    // NOTE: Set GLFW callbacks
+    // NOTE: Callbacks only record what happened, events are dispatched when the queue is
+    // drained after polling
     glfwSetWindowSizeCallback(m_Window, [](GLFWwindow* window, int width, int height) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
         data.width = width;
         data.height = height;
-
-        WindowEvent event(width, height, Action::Resize);
-        data.eventCallback(event);
+        data.events.Push({EventType::Window, Action::Resize, 0, static_cast<double>(width), static_cast<double>(height)});
     });
     glfwSetWindowPosCallback(m_Window, [](GLFWwindow* window, int xPos, int yPos) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-        WindowEvent event(xPos, yPos, Action::Move);
-        data.eventCallback(event);
+        data.events.Push({EventType::Window, Action::Move, 0, static_cast<double>(xPos), static_cast<double>(yPos)});
     });
 
     glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-        WindowEvent event(0, 0, Action::Close);
-        data.eventCallback(event);
+        data.events.Push({EventType::Window, Action::Close});
     });
 
     glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* window, int focused) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-        Action action = focused ? Action::Focus : Action::LoseFocus;
-        WindowEvent event(0, 0, action);
-        data.eventCallback(event);
+        data.events.Push({EventType::Window, focused ? Action::Focus : Action::LoseFocus});
     });
 
     glfwSetWindowIconifyCallback(m_Window, [](GLFWwindow* window, int iconified) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-        Action action = iconified ? Action::Iconify : Action::Restore;
-        WindowEvent event(0, 0, action);
-        data.eventCallback(event);
+        data.events.Push({EventType::Window, iconified ? Action::Iconify : Action::Restore});
     });
 
     glfwSetWindowMaximizeCallback(m_Window, [](GLFWwindow* window, int maximized) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-        Action action = maximized ? Action::Maximize : Action::Restore;
-        WindowEvent event(0, 0, action);
-        data.eventCallback(event);
+        data.events.Push({EventType::Window, maximized ? Action::Maximize : Action::Restore});
     });
 
     glfwSetFramebufferSizeCallback(m_Window, [](GLFWwindow* window, int width, int height) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-        WindowEvent event(width, height, Action::FramebufferResize);
-        data.eventCallback(event);
+        data.events.Push(
+            {EventType::Window, Action::FramebufferResize, 0, static_cast<double>(width), static_cast<double>(height)});
     });
 
     //
@@ -102,74 +117,60 @@ void DefaultWindow::SetCallBackEvents() {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
 
         switch (action) {
-        case GLFW_PRESS: {
-            KeyEvent event(key, Action::KeyPress);
-            data.eventCallback(event);
-
+        case GLFW_PRESS:
+            data.events.Push({EventType::Key, Action::KeyPress, key});
             break;
-        }
-        case GLFW_RELEASE: {
-            KeyEvent event(key, Action::KeyRelease);
-            data.eventCallback(event);
+        case GLFW_RELEASE:
+            data.events.Push({EventType::Key, Action::KeyRelease, key});
             break;
-        }
-        case GLFW_REPEAT: {
-            KeyEvent event(key, Action::KeyRepeat);
-            data.eventCallback(event);
+        case GLFW_REPEAT:
+            data.events.Push({EventType::Key, Action::KeyRepeat, key});
             break;
         }
-        }
     });
 
     glfwSetCharCallback(m_Window, [](GLFWwindow* window, unsigned int keycode) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-        KeyEvent event(keycode, Action::RegisterKeyChar);
-        data.eventCallback(event);
+        data.events.Push({EventType::Key, Action::RegisterKeyChar, static_cast<int32_t>(keycode)});
     });
 
     glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
 
         switch (action) {
-        case GLFW_PRESS: {
-            KeyEvent event(button, Action::KeyPress);
-            data.eventCallback(event);
+        case GLFW_PRESS:
+            data.events.Push({EventType::Key, Action::KeyPress, button});
             break;
-        }
-        case GLFW_RELEASE: {
-            KeyEvent event(button, Action::KeyRelease);
-            data.eventCallback(event);
+        case GLFW_RELEASE:
+            data.events.Push({EventType::Key, Action::KeyRelease, button});
             break;
         }
-        }
     });
 
     glfwSetScrollCallback(m_Window, [](GLFWwindow* window, double xOffset, double yOffset) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-        MouseEvent event(xOffset, yOffset, Action::MouseScroll);
-        data.eventCallback(event);
+        data.events.Push({EventType::Mouse, Action::MouseScroll, 0, xOffset, yOffset});
     });
 
     glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-
-        MouseEvent event(xPos, yPos, Action::MouseMove);
-        data.eventCallback(event);
+        data.events.Push({EventType::Mouse, Action::MouseMove, 0, xPos, yPos});
     });
 
     glfwSetDropCallback(m_Window, [](GLFWwindow* window, int count, const char* paths[]) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
 
+        // NOTE: Paths don't fit a record, the record points at the list kept until the drain
         std::vector<std::string> droppedFiles;
         droppedFiles.reserve(count);
 
         for (int i = 0; i < count; ++i) {
             droppedFiles.emplace_back(paths[i]);
         }
-        DropEvent event(std::move(droppedFiles), Action::Drop);
-        data.eventCallback(event);
+        data.droppedFiles.push_back(std::move(droppedFiles));
+        if (!data.events.Push({EventType::Drop, Action::Drop, static_cast<int32_t>(data.droppedFiles.size() - 1)})) {
+            data.droppedFiles.pop_back();
+        }
     });
 }
 } // namespace forge
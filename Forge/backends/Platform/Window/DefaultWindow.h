@@ -7,8 +7,12 @@
 
 #include <GLFW/glfw3.h>
 
+#include "Forge/Events/EventQueue.h"
 #include "Forge/Renderer/Window.h"
 
+#include <string>
+#include <vector>
+
 namespace forge {
 
 class DefaultWindow final : public Window {
@@ -26,6 +30,7 @@ public:
     }
     void EnableVSync(bool enable) override;
     void Update() override;
+    void WaitEvents(double timeout) override;
 
     // ===============================
 
@@ -44,6 +49,7 @@ public:
 
 private:
     void SetCallBackEvents();
+    void DispatchEvents();
 
     struct WindowData {
         std::string name;
@@ -52,6 +58,9 @@ private:
         bool vsyncEnabled{false};
         bool fullscreen{false};
         EventCallbackFn eventCallback;
+        EventQueue events;
+        // Dropped file lists referenced by queued drop records
+        std::vector<std::vector<std::string>> droppedFiles;
     };
 
     GLFWwindow* m_Window{nullptr};
@@ -0,0 +1,105 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// NOTE: Measures the CPU side of shader construction per stage: SPIR-V parse,
+// reflection and GLSL emission. SPIR-V comes from the shader cache, so the first
+// run warms it and later runs only time the SPIRV-Cross work.
+//
+// Usage: ShaderPipelineBenchmark [--iterations N] [shader files...]
+
+#include "Forge/Renderer/Shader/ShaderCompiler.h"
+#include "Forge/Renderer/Shader/ShaderReflection.h"
+#include "Forge/Utils/FileSystem.h"
+#include "Forge/Utils/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "spirv_cross/spirv.hpp"
+#include "spirv_cross/spirv_glsl.hpp"
+#include "spirv_cross/spirv_parser.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+struct StageTimings {
+    double parse{0.0};
+    double reflect{0.0};
+    double emit{0.0};
+    uint32_t samples{0};
+};
+
+static double ElapsedMs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    forge::Log::Init("ShaderPipelineBenchmark");
+    forge::FileSystem::Init("Reshape");
+
+    std::filesystem::path rootPath = ROOT_PATH;
+    std::error_code error;
+    std::filesystem::current_path(rootPath, error);
+
+    uint32_t iterations = 100;
+    std::vector<forge::ShaderCompileRequest> requests;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = static_cast<uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else {
+            requests.push_back({arg, forge::ShaderOrigin::File});
+        }
+    }
+    if (requests.empty()) {
+        requests.push_back({"shaders/main.glsl", forge::ShaderOrigin::File});
+    }
+
+    forge::ShaderCompiler compiler;
+    auto results = compiler.Compile(requests);
+
+    std::map<std::string, StageTimings> timings;
+    for (const auto& result : results) {
+        for (const auto& [type, spirv] : result.spirv) {
+            auto& stage = timings[result.name + "." + forge::GetShaderTypeName(type)];
+
+            for (uint32_t i = 0; i < iterations; i++) {
+                auto start = Clock::now();
+                spirv_cross::Parser parser(spirv.data(), spirv.size());
+                parser.parse();
+                auto parsed = Clock::now();
+
+                // Same order as OpenGLShader: one parsed module feeds reflection and emission
+                spirv_cross::CompilerGLSL glsl(std::move(parser.get_parsed_ir()));
+                forge::ShaderReflection reflection;
+                reflection.Reflect(glsl, type);
+                auto reflected = Clock::now();
+
+                spirv_cross::CompilerGLSL::Options options;
+                options.version = 450;
+                options.es = false;
+                glsl.set_common_options(options);
+                std::string source = glsl.compile();
+                auto emitted = Clock::now();
+
+                stage.parse += ElapsedMs(start, parsed);
+                stage.reflect += ElapsedMs(parsed, reflected);
+                stage.emit += ElapsedMs(reflected, emitted);
+                stage.samples++;
+            }
+        }
+    }
+
+    forge::Log::Info("{} shaders, {} iterations, average per stage in ms:", results.size(), iterations);
+    forge::Log::Info("{:<32} {:>10} {:>10} {:>10}", "Stage", "Parse", "Reflect", "Emit");
+    for (const auto& [name, stage] : timings) {
+        double samples = stage.samples ? static_cast<double>(stage.samples) : 1.0;
+        forge::Log::Info("{:<32} {:>10.4f} {:>10.4f} {:>10.4f}", name, stage.parse / samples, stage.reflect / samples,
+                         stage.emit / samples);
+    }
+
+    return 0;
+}
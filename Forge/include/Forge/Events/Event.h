@@ -52,16 +52,12 @@ public:
 //=== Keyboard Get Key ===================================
 //========================================================
 
+// NOTE: Keyboard and Mouse read the snapshot InputState published for the current frame,
+// so every caller in a frame sees the same values. Inside event handlers they read the input
+// as of the event being handled instead, see InputState::GetCurrent.
 class Keyboard {
 public:
     static bool const IsKeyPressed(int key);
-    friend class KeyEvent;
-
-protected:
-    static void SetKey(int key, bool IsKeyPressed);
-
-private:
-    static std::vector<bool> m_Keys;
 };
 
 //========================================================
@@ -70,29 +66,12 @@ private:
 
 class Mouse {
 public:
-    friend class MouseEvent;
-
     static std::pair<double, double> const GetMousePosition();
 
+    // Movement and scroll accumulated since the previous frame
     static std::pair<double, double> const GetMouseDeltaMovement();
 
     static std::pair<double, double> const GetMouseDeltaScroll();
-
-protected:
-    static void SetCursorPosition(double _x, double _y);
-    static void SetWheelScroll(double dx, double dy);
-
-private:
-    static double lastx;
-    static double lasty;
-    static double dx;
-    static double dy;
-
-    static double x;
-    static double y;
-
-    static double scrollDx;
-    static double scrollDy;
 };
 
 //========================================================
@@ -101,7 +80,7 @@ private:
 
 class ApplicationStats {
 public:
-    friend class WindowEvent;
+    friend class EventQueue;
 
     static std::pair<double, double> const GetApplicationPosition();
     static std::pair<double, double> const GetApplicationSize();
@@ -0,0 +1,109 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef EVENTDISPATCHER_H
+#define EVENTDISPATCHER_H
+
+#include "Event.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace forge {
+
+// NOTE: Layers are visited in declaration order, a handler that consumes an event hides
+// it from every later one
+enum class EventPriority : uint8_t {
+    Overlay,     // Panels and popups drawn over the viewport
+    Tool,        // Active tool or gizmo
+    Viewport,    // Camera navigation and selection
+    Application, // Everything left
+};
+
+using SubscriptionID = uint32_t;
+inline constexpr SubscriptionID INVALID_SUBSCRIPTION = 0;
+
+// Returns true when the event was consumed
+using EventHandlerFn = std::function<bool(const Event&)>;
+
+// NOTE: Routes each event to the handlers subscribed to its (EventType, Action) pair.
+// Action::None subscribes to every action of a type and EventType::None to every event.
+// Handlers live in one contiguous array per pair, kept sorted by priority and then by
+// subscription order. Subscribing and unsubscribing from inside a handler is allowed,
+// the changes apply once the outermost Dispatch returns.
+class EventDispatcher {
+public:
+    EventDispatcher() = default;
+
+    EventDispatcher(const EventDispatcher&) = delete;
+    EventDispatcher& operator=(const EventDispatcher&) = delete;
+
+    SubscriptionID Subscribe(EventType type, Action action, EventHandlerFn handler,
+                             EventPriority priority = EventPriority::Application);
+
+    // Typed variant, `handler` takes the concrete event and may return void (never consumes)
+    template <typename E, typename Fn>
+    SubscriptionID Subscribe(Action action, Fn&& handler, EventPriority priority = EventPriority::Application) {
+        return Subscribe(
+            E::GetStaticType(), action,
+            [handler = std::forward<Fn>(handler)](const Event& event) mutable {
+                const E& typed = static_cast<const E&>(event);
+                if constexpr (std::is_void_v<std::invoke_result_t<Fn&, const E&>>) {
+                    handler(typed);
+                    return false;
+                } else {
+                    return static_cast<bool>(handler(typed));
+                }
+            },
+            priority);
+    }
+
+    void Unsubscribe(SubscriptionID id);
+
+    // Returns true when a handler consumed the event
+    bool Dispatch(const Event& event);
+
+    [[nodiscard]] uint32_t GetSubscriberCount() const noexcept {
+        return static_cast<uint32_t>(m_Slots.size());
+    }
+
+private:
+    static constexpr uint32_t TYPE_COUNT = static_cast<uint32_t>(EventType::Button) + 1;
+    static constexpr uint32_t ACTION_COUNT = static_cast<uint32_t>(Action::UIEvent) + 1;
+
+    struct Subscriber {
+        SubscriptionID id{INVALID_SUBSCRIPTION};
+        EventPriority priority{EventPriority::Application};
+        EventHandlerFn handler;
+    };
+
+    struct PendingSubscriber {
+        uint32_t slot{0};
+        Subscriber subscriber;
+    };
+
+    [[nodiscard]] static uint32_t GetSlot(EventType type, Action action) noexcept {
+        return static_cast<uint32_t>(type) * ACTION_COUNT + static_cast<uint32_t>(action);
+    }
+
+    void Insert(uint32_t slot, Subscriber subscriber);
+    void ApplyPendingChanges();
+
+    std::array<std::vector<Subscriber>, TYPE_COUNT * ACTION_COUNT> m_Tables;
+    // Subscription to the table it lives in
+    std::unordered_map<SubscriptionID, uint32_t> m_Slots;
+
+    std::vector<PendingSubscriber> m_PendingSubscribers;
+    bool m_HasRemovedSubscribers{false};
+    uint32_t m_DispatchDepth{0};
+    SubscriptionID m_NextID{1};
+};
+
+} // namespace forge
+
+#endif
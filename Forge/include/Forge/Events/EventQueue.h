@@ -0,0 +1,123 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include "Event.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace forge {
+
+// NOTE: Plain copy of what a window callback reported. `code` is the key or button for
+// key events and an index into the window's dropped file lists for drop events, `x` and
+// `y` carry cursor, scroll, position or size values.
+struct EventRecord {
+    EventType type{EventType::None};
+    Action action{Action::None};
+    int32_t code{0};
+    double x{0.0};
+    double y{0.0};
+};
+static_assert(std::is_trivially_copyable_v<EventRecord>, "EventRecord must stay a plain record");
+
+struct EventQueueStats {
+    uint64_t pushed{0};
+    uint64_t dropped{0};
+    uint64_t coalesced{0};
+    uint64_t dispatched{0};
+};
+
+// NOTE: Fixed capacity single producer, single consumer ring of event records. Window
+// callbacks push, the frame loop drains everything queued in one batch. Within a batch a
+// run of records that only report the latest value (cursor moves, window moves and resizes)
+// is reduced to its last record. Nothing allocates and a full queue drops new records.
+class EventQueue {
+public:
+    static constexpr uint32_t CAPACITY = 1024;
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "EventQueue capacity must be a power of two");
+
+    // Producer side
+    bool Push(const EventRecord& record) noexcept {
+        uint32_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_Head.load(std::memory_order_acquire) == CAPACITY) {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        m_Records[tail & (CAPACITY - 1)] = record;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, calls `dispatch` for every record left after coalescing
+    template <typename Fn>
+    uint32_t Drain(Fn&& dispatch) {
+        uint32_t head = m_Head.load(std::memory_order_relaxed);
+        uint32_t tail = m_Tail.load(std::memory_order_acquire);
+
+        uint32_t dispatched = 0;
+        for (uint32_t index = head; index != tail; index++) {
+            const EventRecord& record = m_Records[index & (CAPACITY - 1)];
+            if (index + 1 != tail && IsCoalescable(record)) {
+                const EventRecord& next = m_Records[(index + 1) & (CAPACITY - 1)];
+                if (next.type == record.type && next.action == record.action) {
+                    m_Stats.coalesced++;
+                    continue;
+                }
+            }
+
+            ApplyState(record);
+            dispatch(record);
+            dispatched++;
+        }
+
+        m_Head.store(tail, std::memory_order_release);
+        m_Stats.pushed += tail - head;
+        m_Stats.dispatched += dispatched;
+        return dispatched;
+    }
+
+    // Consumer side, empties the queue without coalescing or applying state
+    template <typename Fn>
+    void Discard(Fn&& inspect) {
+        uint32_t head = m_Head.load(std::memory_order_relaxed);
+        uint32_t tail = m_Tail.load(std::memory_order_acquire);
+        for (uint32_t index = head; index != tail; index++) {
+            inspect(m_Records[index & (CAPACITY - 1)]);
+        }
+        m_Head.store(tail, std::memory_order_release);
+        m_Stats.pushed += tail - head;
+    }
+
+    [[nodiscard]] uint32_t GetSize() const noexcept {
+        return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire);
+    }
+    // NOTE: Consumer side only
+    [[nodiscard]] EventQueueStats GetStats() const noexcept {
+        EventQueueStats stats = m_Stats;
+        stats.dropped = m_Dropped.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    [[nodiscard]] static bool IsCoalescable(const EventRecord& record) noexcept;
+
+    // NOTE: Feeds InputState and updates ApplicationStats with what a record describes, done
+    // once per dispatched record
+    static void ApplyState(const EventRecord& record) noexcept;
+
+private:
+    std::array<EventRecord, CAPACITY> m_Records{};
+    alignas(64) std::atomic<uint32_t> m_Head{0};
+    alignas(64) std::atomic<uint32_t> m_Tail{0};
+    alignas(64) std::atomic<uint64_t> m_Dropped{0};
+    EventQueueStats m_Stats;
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,99 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef EVENTRECORDING_H
+#define EVENTRECORDING_H
+
+#include "EventQueue.h"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+namespace forge {
+
+// NOTE: Binary layout of a recording: one header followed by one entry per dispatched
+// record, in dispatch order. Values are stored in native byte order, recordings are meant
+// to be replayed on the machine class that made them.
+struct EventRecordingHeader {
+    static constexpr uint32_t MAGIC = 0x54564552; // "REVT"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic{MAGIC};
+    uint32_t version{VERSION};
+    uint32_t width{0};
+    uint32_t height{0};
+};
+
+struct EventRecordingEntry {
+    // Drawn frame the record was dispatched for, replay dispatches it on the same frame
+    uint64_t frame{0};
+    // Seconds since the recording started
+    double time{0.0};
+    EventRecord record;
+};
+static_assert(std::is_trivially_copyable_v<EventRecordingEntry>, "EventRecordingEntry is written as raw bytes");
+
+class EventRecorder {
+public:
+    [[nodiscard]] bool Open(const std::string& path, uint32_t width, uint32_t height);
+    void Record(uint64_t frame, const EventRecord& record);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return m_File.is_open();
+    }
+    [[nodiscard]] uint64_t GetRecordCount() const noexcept {
+        return m_RecordCount;
+    }
+
+private:
+    std::ofstream m_File;
+    std::chrono::steady_clock::time_point m_Start;
+    uint64_t m_RecordCount{0};
+};
+
+class EventPlayer {
+public:
+    [[nodiscard]] bool Open(const std::string& path);
+
+    // Calls `dispatch` for every entry recorded up to and including `frame`
+    template <typename Fn>
+    void Play(uint64_t frame, Fn&& dispatch) {
+        while (m_HasNext && m_Next.frame <= frame) {
+            dispatch(m_Next.record);
+            m_PlayedCount++;
+            ReadNext();
+        }
+    }
+
+    [[nodiscard]] bool IsFinished() const noexcept {
+        return !m_HasNext;
+    }
+    [[nodiscard]] const EventRecordingHeader& GetHeader() const noexcept {
+        return m_Header;
+    }
+    [[nodiscard]] uint64_t GetPlayedCount() const noexcept {
+        return m_PlayedCount;
+    }
+    // NOTE: Time stamp of the last entry read, the length of the recorded session once finished
+    [[nodiscard]] double GetRecordedTime() const noexcept {
+        return m_RecordedTime;
+    }
+
+private:
+    void ReadNext();
+
+    std::ifstream m_File;
+    EventRecordingHeader m_Header;
+    EventRecordingEntry m_Next;
+    bool m_HasNext{false};
+    uint64_t m_PlayedCount{0};
+    double m_RecordedTime{0.0};
+};
+
+} // namespace forge
+
+#endif
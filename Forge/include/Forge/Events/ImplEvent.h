@@ -13,26 +13,19 @@
 
 namespace forge {
 
+// NOTE: Events are views built when the window drains its EventQueue, input and window
+// state is updated there and not by the constructors
 class KeyEvent : public Event {
 public:
     KeyEvent(int key, Action action)
-        : key_(key) {
+        : key_(key)
+        , action_(action) {
         if (key == Key::LeftMouse || key == Key::MiddleMouse || key == Key::RightMouse) {
             if (action == Action::KeyPress) {
                 action_ = Action::MousePress;
-                Keyboard::SetKey(key, true);
             }
             if (action == Action::KeyRelease) {
                 action_ = Action::MouseRelease;
-                Keyboard::SetKey(key, false);
-            }
-        } else {
-            action_ = action;
-            if (action == Action::KeyPress) {
-                Keyboard::SetKey(key, true);
-            }
-            if (action == Action::KeyRelease) {
-                Keyboard::SetKey(key, false);
             }
         }
     };
@@ -40,9 +33,12 @@ public:
     int GetKey() const {
         return key_;
     }
-    EventType GetType() const override {
+    static constexpr EventType GetStaticType() {
         return EventType::Key;
     }
+    EventType GetType() const override {
+        return GetStaticType();
+    }
     Action GetAction() const override {
         return action_;
     };
@@ -62,14 +58,7 @@ public:
     MouseEvent(double x, double y, Action action)
         : x_(x)
         , y_(y)
-        , action_(action) {
-        if (action == Action::MouseMove) {
-            Mouse::SetCursorPosition(x, y);
-        }
-        if (action == Action::MouseScroll) {
-            Mouse::SetWheelScroll(x, y);
-        }
-    }
+        , action_(action) {}
     double GetX() const {
         return x_;
     }
@@ -77,9 +66,12 @@ public:
         return y_;
     }
 
-    EventType GetType() const override {
+    static constexpr EventType GetStaticType() {
         return EventType::Mouse;
     }
+    EventType GetType() const override {
+        return GetStaticType();
+    }
     Action GetAction() const override {
         return action_;
     };
@@ -100,33 +92,7 @@ public:
     WindowEvent(int x, int y, Action action)
         : x_(x)
         , y_(y)
-        , action_(action) {
-        switch (action) {
-        case Action::Move:
-            ApplicationStats::SetApplicationPosition(x, y);
-            break;
-        case Action::Resize:
-            ApplicationStats::SetApplicationSize(x, y);
-            break;
-        case Action::Maximize:
-            ApplicationStats::SetFullscreen(true);
-            break;
-        case Action::Restore:
-            ApplicationStats::SetFullscreen(false);
-            break;
-        case Action::Iconify:
-            ApplicationStats::SetFullscreen(false);
-            break;
-        case Action::Focus:
-            ApplicationStats::SetFocused(true);
-            break;
-        case Action::LoseFocus:
-            ApplicationStats::SetFocused(false);
-            break;
-        default:
-            break;
-        }
-    }
+        , action_(action) {}
     double GetX() const {
         return x_;
     }
@@ -134,9 +100,12 @@ public:
         return y_;
     }
 
-    EventType GetType() const override {
+    static constexpr EventType GetStaticType() {
         return EventType::Window;
     }
+    EventType GetType() const override {
+        return GetStaticType();
+    }
     Action GetAction() const override {
         return action_;
     };
@@ -161,9 +130,12 @@ public:
     std::vector<std::string> GetFiles() const {
         return filePaths_;
     }
-    EventType GetType() const override {
+    static constexpr EventType GetStaticType() {
         return EventType::Drop;
     }
+    EventType GetType() const override {
+        return GetStaticType();
+    }
 
     Action GetAction() const override {
         return action_;
@@ -0,0 +1,100 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef INPUTSNAPSHOT_H
+#define INPUTSNAPSHOT_H
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+
+namespace forge {
+
+// NOTE: Input as it stood at the start of a frame. Deltas, scroll and the pressed and
+// released edges cover everything that happened since the previous frame.
+struct InputSnapshot {
+    static constexpr uint32_t KEY_COUNT = 512;
+
+    std::bitset<KEY_COUNT> down;
+    std::bitset<KEY_COUNT> pressed;
+    std::bitset<KEY_COUNT> released;
+
+    double cursorX{0.0};
+    double cursorY{0.0};
+    double deltaX{0.0};
+    double deltaY{0.0};
+    double scrollX{0.0};
+    double scrollY{0.0};
+
+    uint64_t frame{0};
+
+    [[nodiscard]] bool IsKeyDown(int key) const noexcept {
+        return IsValidKey(key) && down.test(key);
+    }
+    [[nodiscard]] bool WasKeyPressed(int key) const noexcept {
+        return IsValidKey(key) && pressed.test(key);
+    }
+    [[nodiscard]] bool WasKeyReleased(int key) const noexcept {
+        return IsValidKey(key) && released.test(key);
+    }
+
+    [[nodiscard]] static constexpr bool IsValidKey(int key) noexcept {
+        return key >= 0 && key < static_cast<int>(KEY_COUNT);
+    }
+};
+
+// NOTE: Accumulates input from the window's event queue and publishes it once per frame.
+// The On* calls and Publish belong to the thread that drains window events. GetSnapshot
+// may be called from any thread without locking: published snapshots rotate through
+// three slots, so the one a reader got stays untouched until the second Publish after it.
+// Work that spans more frames than that copies the snapshot.
+class InputState {
+public:
+    static InputState& Get();
+
+    void OnKey(int key, bool down) noexcept;
+    void OnCursor(double x, double y) noexcept;
+    void OnScroll(double x, double y) noexcept;
+
+    // NOTE: Called by the FrameScheduler at the start of every drawn frame
+    void Publish() noexcept;
+
+    // NOTE: Frame the input received now is published with
+    [[nodiscard]] uint64_t GetFrame() const noexcept {
+        return m_Pending.frame;
+    }
+
+    [[nodiscard]] const InputSnapshot& GetSnapshot() const noexcept {
+        return m_Snapshots[m_Published.load(std::memory_order_acquire)];
+    }
+
+    // NOTE: What the Keyboard and Mouse facades read. Events are dispatched before the frame's
+    // snapshot is published, so on the thread dispatching them this is the state still being
+    // accumulated, which already includes the event being handled (e.g. a modifier pressed
+    // this frame). Everywhere else it is the published snapshot.
+    [[nodiscard]] const InputSnapshot& GetCurrent() const noexcept;
+
+    // NOTE: Marks the calling thread as dispatching window events for its lifetime
+    class DispatchScope {
+    public:
+        DispatchScope() noexcept;
+        ~DispatchScope();
+
+        DispatchScope(const DispatchScope&) = delete;
+        DispatchScope& operator=(const DispatchScope&) = delete;
+    };
+
+private:
+    InputState() = default;
+
+    InputSnapshot m_Pending;
+    bool m_HasCursor{false};
+
+    std::array<InputSnapshot, 3> m_Snapshots;
+    std::atomic<uint32_t> m_Published{0};
+};
+
+} // namespace forge
+
+#endif
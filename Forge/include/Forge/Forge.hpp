@@ -13,12 +13,23 @@
 #include "Forge/Renderer/GraphicsContext.h"
 #include "Forge/Renderer/RenderAPI.h"
 #include "Renderer/Buffer.h"
+#include "Renderer/BufferHeap.h"
 #include "Renderer/BufferImpl.h"
+#include "Renderer/CommandBuffer.h"
+#include "Renderer/FrameScheduler.h"
+#include "Renderer/Material.h"
+#include "Renderer/MeshBatch.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/ResourceLoader.h"
 #include "Renderer/Shader.h"
+#include "Renderer/VertexPacking.h"
 #include "Renderer/Window.h"
 
 #include "Events/Event.h"
+#include "Events/EventDispatcher.h"
+#include "Events/EventQueue.h"
 #include "Events/ImplEvent.h"
+#include "Events/InputSnapshot.h"
 #include "Events/KeyCodes.h"
 
 #endif
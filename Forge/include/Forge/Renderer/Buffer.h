@@ -6,7 +6,9 @@
 
 #include "Forge/Utils/Common.h"
 #include <cstdint>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace forge {
@@ -22,6 +24,56 @@ public:
 private:
 };
 
+// NOTE: Move-only owner of CPU side buffer contents. Loaders hand their vectors over without
+// another copy, ResourceLoader::UploadVertexBuffer keeps them until the GPU has the data.
+class BufferData {
+public:
+    BufferData() = default;
+
+    template <typename T>
+    explicit BufferData(std::vector<T>&& values)
+        : m_Size(static_cast<uint32_t>(values.size() * sizeof(T))) {
+        static_assert(std::is_trivially_copyable_v<T>, "Buffer data must be trivially copyable");
+        auto storage = CreateUnique<Storage<T>>(std::move(values));
+        m_Data = storage->values.data();
+        m_Storage = std::move(storage);
+    }
+
+    BufferData(BufferData&& other) noexcept;
+    BufferData& operator=(BufferData&& other) noexcept;
+    BufferData(const BufferData&) = delete;
+    BufferData& operator=(const BufferData&) = delete;
+
+    [[nodiscard]] const void* GetData() const noexcept {
+        return m_Data;
+    }
+    // Size in bytes
+    [[nodiscard]] uint32_t GetSize() const noexcept {
+        return m_Size;
+    }
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return m_Size == 0;
+    }
+
+    void Release() noexcept;
+
+private:
+    struct StorageBase {
+        virtual ~StorageBase() = default;
+    };
+
+    template <typename T>
+    struct Storage final : StorageBase {
+        explicit Storage(std::vector<T>&& data)
+            : values(std::move(data)) {}
+        std::vector<T> values;
+    };
+
+    Unique<StorageBase> m_Storage;
+    const void* m_Data{nullptr};
+    uint32_t m_Size{0};
+};
+
 enum class BufferDataType {
     None = 0,
     Float,
@@ -34,8 +86,21 @@ enum class BufferDataType {
     Int2,
     Int3,
     Int4,
-    Bool
-
+    Bool,
+
+    // NOTE: Compact formats. Half types are IEEE half floats, Norm types are read by the shader
+    // as floats in [0, 1] (unsigned) or [-1, 1] (signed), packed types hold x, y, z in 10 bits
+    // and w in 2 bits of one 32 bit word. VertexPacking.h has the matching CPU packers.
+    Half2,
+    Half4,
+    UByte4,
+    UByte4Norm,
+    Byte4Norm,
+    UShort2Norm,
+    Short2Norm,
+    Short4Norm,
+    Int2_10_10_10_Rev,
+    UInt2_10_10_10_Rev
 };
 
 constexpr unsigned int GetDataTypeSize(BufferDataType type) {
@@ -62,6 +127,22 @@ constexpr unsigned int GetDataTypeSize(BufferDataType type) {
         return 4 * 4;
     case BufferDataType::Bool:
         return 1;
+    case BufferDataType::Half2:
+        return 2 * 2;
+    case BufferDataType::Half4:
+        return 2 * 4;
+    case BufferDataType::UByte4:
+    case BufferDataType::UByte4Norm:
+    case BufferDataType::Byte4Norm:
+        return 1 * 4;
+    case BufferDataType::UShort2Norm:
+    case BufferDataType::Short2Norm:
+        return 2 * 2;
+    case BufferDataType::Short4Norm:
+        return 2 * 4;
+    case BufferDataType::Int2_10_10_10_Rev:
+    case BufferDataType::UInt2_10_10_10_Rev:
+        return 4;
     case BufferDataType::None:
         return 0;
     }
@@ -69,25 +150,62 @@ constexpr unsigned int GetDataTypeSize(BufferDataType type) {
     return 0;
 }
 
+// NOTE: Fixed point data the shader reads as floats
+constexpr bool IsNormalizedDataType(BufferDataType type) {
+    switch (type) {
+    case BufferDataType::UByte4Norm:
+    case BufferDataType::Byte4Norm:
+    case BufferDataType::UShort2Norm:
+    case BufferDataType::Short2Norm:
+    case BufferDataType::Short4Norm:
+    case BufferDataType::Int2_10_10_10_Rev:
+    case BufferDataType::UInt2_10_10_10_Rev:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// NOTE: Data the shader reads as ints (ivec/uvec inputs), never converted to float
+constexpr bool IsIntegerDataType(BufferDataType type) {
+    switch (type) {
+    case BufferDataType::Int:
+    case BufferDataType::Int2:
+    case BufferDataType::Int3:
+    case BufferDataType::Int4:
+    case BufferDataType::UByte4:
+    case BufferDataType::Bool:
+        return true;
+    default:
+        return false;
+    }
+}
+
 struct BufferElement {
     std::string name;
     BufferDataType type;
     unsigned int size;
     unsigned int offset;
+    bool normalized;
 
     BufferElement(BufferDataType type, std::string name)
         : name(name)
         , type(type)
         , size(GetDataTypeSize(type))
-        , offset(0) {}
+        , offset(0)
+        , normalized(IsNormalizedDataType(type)) {}
 };
 
+// NOTE: A divisor of 0 advances the attributes per vertex, N advances them once every
+// N instances (per instance data for instanced draws)
 class BufferLayout {
 public:
     BufferLayout() = default;
-    BufferLayout(std::initializer_list<BufferElement> elements);
+    BufferLayout(std::initializer_list<BufferElement> elements, uint32_t divisor = 0);
 
     uint32_t GetStride() const;
+    uint32_t GetDivisor() const;
+    bool IsInstanced() const;
     const std::vector<BufferElement>& GetElements() const;
 
     std::vector<BufferElement>::iterator begin();
@@ -100,6 +218,7 @@ private:
 
     std::vector<BufferElement> m_Elements;
     uint32_t m_Stride{0};
+    uint32_t m_Divisor{0};
 };
 
 } // namespace forge
@@ -0,0 +1,126 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef BUFFERHEAP_H
+#define BUFFERHEAP_H
+
+#include "Forge/Renderer/BufferImpl.h"
+#include "Forge/Utils/Common.h"
+#include "Forge/Utils/TLSFAllocator.h"
+#include <cstdint>
+#include <vector>
+
+namespace forge {
+
+enum class BufferHeapUsage : uint8_t { Vertex, Index };
+
+struct BufferHeapHandle {
+    uint32_t index{UINT32_MAX};
+    uint32_t generation{0};
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return index != UINT32_MAX;
+    }
+    bool operator==(const BufferHeapHandle&) const = default;
+};
+
+// NOTE: Where an allocation lives right now, only valid until the heap layout version changes
+struct BufferHeapRange {
+    Buffer* buffer{nullptr};
+    uint32_t page{0};
+    uint32_t offset{0};
+    uint32_t size{0};
+};
+
+struct BufferHeapStats {
+    uint32_t pageCount{0};
+    uint32_t allocationCount{0};
+    uint64_t capacity{0};
+    uint64_t usedSize{0};
+    uint32_t largestFreeBlock{0};
+    float fragmentation{0.0f};
+};
+
+// NOTE: Sub-allocates many small vertex or index ranges out of a few large backing buffers
+// (pages), each page managed by a TLSF allocator. Handles stay valid across Defragment, which
+// compacts pages in place on the GPU, so resolved offsets have to be fetched again whenever
+// GetLayoutVersion changes. The backing buffers never change, vertex arrays built over a page
+// stay valid. Vertex data is usually allocated with the vertex stride as alignment so the
+// offset divides into a base vertex; vertex heaps given a stride size their pages to a whole
+// number of vertices so a layout can be set on them. The heap itself belongs to one thread,
+// but pages are Dynamic buffers, a range resolved there can be written from a loader job.
+class BufferHeap {
+public:
+    static constexpr uint32_t DEFAULT_PAGE_SIZE = 64 * 1024 * 1024;
+
+    explicit BufferHeap(BufferHeapUsage usage, uint32_t pageSize = DEFAULT_PAGE_SIZE, uint32_t vertexStride = 0);
+
+    // NOTE: Allocations larger than a page get a dedicated page. data may be null.
+    [[nodiscard]] BufferHeapHandle Allocate(const void* data, uint32_t size, uint32_t alignment = TLSFAllocator::GRANULARITY);
+    void Update(BufferHeapHandle handle, const void* data, uint32_t size, uint32_t offset = 0);
+    void Free(BufferHeapHandle handle);
+
+    [[nodiscard]] BufferHeapRange Resolve(BufferHeapHandle handle) const;
+
+    // NOTE: Compacts every page whose fragmentation is above threshold, returns the bytes moved
+    uint64_t Defragment(float threshold = 0.25f);
+
+    [[nodiscard]] uint64_t GetLayoutVersion() const noexcept {
+        return m_LayoutVersion;
+    }
+    [[nodiscard]] BufferHeapUsage GetUsage() const noexcept {
+        return m_Usage;
+    }
+    // NOTE: Allocations that fit no existing page fail instead of creating one once the heap
+    // has this many pages, 0 means no limit. For consumers that build one vertex array per page.
+    void SetPageLimit(uint32_t pageLimit) noexcept {
+        m_PageLimit = pageLimit;
+    }
+    [[nodiscard]] uint32_t GetPageCount() const noexcept {
+        return static_cast<uint32_t>(m_Pages.size());
+    }
+    [[nodiscard]] const Shared<VertexBuffer>& GetVertexBuffer(uint32_t page) const;
+    [[nodiscard]] const Shared<IndexBuffer>& GetIndexBuffer(uint32_t page) const;
+
+    [[nodiscard]] BufferHeapStats GetStats() const;
+
+private:
+    struct Page {
+        Shared<VertexBuffer> vertexBuffer;
+        Shared<IndexBuffer> indexBuffer;
+        TLSFAllocator allocator;
+        uint32_t allocationCount{0};
+    };
+
+    struct Entry {
+        TLSFAllocation allocation;
+        uint32_t page{0};
+        uint32_t alignment{0};
+        uint32_t generation{0};
+        bool live{false};
+    };
+
+    uint32_t CreatePage(uint32_t size);
+    [[nodiscard]] Buffer* GetPageBuffer(const Page& page) const;
+    void WritePage(Page& page, const void* data, uint32_t size, uint32_t offset);
+    void MoveWithinPage(Page& page, uint32_t sourceOffset, uint32_t offset, uint32_t size);
+    uint64_t CompactPage(uint32_t page);
+    [[nodiscard]] const Entry* FindEntry(BufferHeapHandle handle) const;
+
+private:
+    BufferHeapUsage m_Usage;
+    uint32_t m_PageSize{0};
+    // Page sizes are a multiple of this
+    uint32_t m_PageGranularity{TLSFAllocator::GRANULARITY};
+    uint32_t m_PageLimit{0};
+
+    std::vector<Page> m_Pages;
+    std::vector<Entry> m_Entries;
+    std::vector<uint32_t> m_FreeEntries;
+
+    uint64_t m_LayoutVersion{0};
+};
+
+} // namespace forge
+
+#endif
@@ -6,41 +6,92 @@
 
 #include "Forge/Renderer/Buffer.h"
 #include <cstdint>
+#include <ranges>
+#include <span>
+#include <type_traits>
 namespace forge {
 
-enum class BufferDrawMode : uint8_t { Static, Dynamic };
+// NOTE: Static data is uploaded once. Dynamic updates go straight to the buffer, which
+// waits for the GPU when it is still reading it. Stream updates go through a staging ring
+// and a GPU side copy, meant for data that changes while it is being drawn.
+enum class BufferDrawMode : uint8_t { Static, Dynamic, Stream };
+
+// NOTE: Number of frames the CPU may run ahead of the GPU, per frame resources
+// (e.g. the UniformBuffer ring) keep this many regions
+inline constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 3;
 
 //========================================
 //  Vertex Buffer
 //========================================
 
+// NOTE: All sizes and offsets are in bytes. The layout stride has to divide the buffer size.
 class VertexBuffer : public Buffer {
 public:
     virtual ~VertexBuffer() = default;
-    virtual void SubmitData(const void* data, uint32_t count, uint32_t offset = 0) = 0;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+    // NOTE: Copies size bytes inside the buffer on the GPU, the ranges must not overlap
+    virtual void CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) = 0;
+    // NOTE: Stream buffers only. Returns mapped staging memory for size bytes that land at
+    // offset once EndWrite is called, so producers fill it without an intermediate copy
+    [[nodiscard]] virtual void* BeginWrite(uint32_t offset, uint32_t size) = 0;
+    virtual void EndWrite() = 0;
     virtual const BufferLayout& GetLayout() const = 0;
     virtual void SetLayout(const BufferLayout& layout) = 0;
+    [[nodiscard]] virtual uint32_t GetSize() const = 0;
+
+    template <std::ranges::contiguous_range R>
+    void SubmitData(const R& values, uint32_t offset = 0) {
+        std::span data{values};
+        SubmitData(data.data(), static_cast<uint32_t>(data.size_bytes()), offset);
+    }
+
+    static Shared<VertexBuffer> Create(const void* data, uint32_t size, BufferDrawMode mode = BufferDrawMode::Static);
 
-    static Shared<VertexBuffer> Create(const void* data, uint32_t count, BufferDrawMode mode = BufferDrawMode::Static);
+    // NOTE: Sized from the data itself, e.g. a std::span<const Vertex>, a vector or an array
+    template <std::ranges::contiguous_range R>
+    static Shared<VertexBuffer> Create(const R& vertices, BufferDrawMode mode = BufferDrawMode::Static) {
+        static_assert(std::is_trivially_copyable_v<std::ranges::range_value_t<R>>, "Vertices must be trivially copyable");
+        std::span data{vertices};
+        return Create(data.data(), static_cast<uint32_t>(data.size_bytes()), mode);
+    }
+
+protected:
+    // NOTE: Logs and returns false when the stride does not divide the buffer size
+    [[nodiscard]] static bool ValidateLayout(const BufferLayout& layout, uint32_t size);
 };
 
 //========================================
 //  Index Buffer
 //========================================
 
+// NOTE: 32 bit indices. Created from an index count, updated with sizes and offsets in bytes.
 class IndexBuffer : public Buffer {
 public:
     virtual ~IndexBuffer() = default;
-    virtual void SubmitData(const void* data, uint32_t count, uint32_t offset = 0) = 0;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+    // NOTE: Copies size bytes inside the buffer on the GPU, the ranges must not overlap
+    virtual void CopyData(uint32_t sourceOffset, uint32_t offset, uint32_t size) = 0;
+    // NOTE: Stream buffers only. Returns mapped staging memory for size bytes that land at
+    // offset once EndWrite is called, so producers fill it without an intermediate copy
+    [[nodiscard]] virtual void* BeginWrite(uint32_t offset, uint32_t size) = 0;
+    virtual void EndWrite() = 0;
     virtual uint32_t GetCount() const = 0;
 
-    static Shared<IndexBuffer> Create(uint32_t* data, uint32_t count, BufferDrawMode mode = BufferDrawMode::Static);
+    void SubmitData(std::span<const uint32_t> indices, uint32_t firstIndex = 0) {
+        SubmitData(indices.data(), static_cast<uint32_t>(indices.size_bytes()),
+                   firstIndex * static_cast<uint32_t>(sizeof(uint32_t)));
+    }
+
+    static Shared<IndexBuffer> Create(const uint32_t* data, uint32_t count, BufferDrawMode mode = BufferDrawMode::Static);
+    static Shared<IndexBuffer> Create(std::span<const uint32_t> indices, BufferDrawMode mode = BufferDrawMode::Static);
 };
 
 //========================================
 //  VertexArray Buffer
 //========================================
 
+// NOTE: Attribute locations continue across vertex buffers in the order they are added,
+// matrices take one location per column
 class VertexArrayBuffer : public Buffer {
 public:
     virtual ~VertexArrayBuffer() = default;
@@ -51,6 +102,79 @@ public:
     static Shared<VertexArrayBuffer> Create();
 };
 
+//========================================
+//  Uniform Buffer
+//========================================
+
+struct UniformAllocation {
+    void* data{nullptr};
+    uint32_t offset{0};
+    uint32_t size{0};
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return data != nullptr;
+    }
+};
+
+// NOTE: Persistently mapped ring with one region per frame in flight. Allocations are
+// only valid for the current frame (RenderAPI::BeginFrame/EndFrame), the region is reused
+// MAX_FRAMES_IN_FLIGHT frames later once the GPU is done with it, so writes never stall.
+class UniformBuffer : public Buffer {
+public:
+    virtual ~UniformBuffer() = default;
+
+    // NOTE: Returns aligned space in the current frame region, invalid when it is full. The
+    // capacity is fixed, owners that can't bound their demand replace the ring with a larger one
+    [[nodiscard]] virtual UniformAllocation Allocate(uint32_t size) = 0;
+    virtual void BindRange(uint32_t binding, const UniformAllocation& allocation) const = 0;
+    [[nodiscard]] virtual uint32_t GetFrameCapacity() const = 0;
+
+    // Allocate and copy in one step
+    [[nodiscard]] UniformAllocation Upload(const void* data, uint32_t size);
+
+    static Shared<UniformBuffer> Create(uint32_t frameCapacity);
+};
+
+//========================================
+//  Storage Buffer
+//========================================
+
+// NOTE: Shader storage block data, laid out std430 by the caller
+class StorageBuffer : public Buffer {
+public:
+    virtual ~StorageBuffer() = default;
+    virtual void SubmitData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+    virtual void BindBase(uint32_t binding) const = 0;
+    [[nodiscard]] virtual uint32_t GetSize() const = 0;
+
+    static Shared<StorageBuffer> Create(const void* data, uint32_t size, BufferDrawMode mode = BufferDrawMode::Dynamic);
+};
+
+//========================================
+//  Indirect Buffer
+//========================================
+
+// NOTE: Same layout as the commands read by glMultiDrawElementsIndirect and
+// vkCmdDrawIndexedIndirect, do not reorder
+struct DrawIndexedIndirectCommand {
+    uint32_t indexCount{0};
+    uint32_t instanceCount{1};
+    uint32_t firstIndex{0};
+    int32_t baseVertex{0};
+    uint32_t baseInstance{0};
+};
+static_assert(sizeof(DrawIndexedIndirectCommand) == 20, "DrawIndexedIndirectCommand must be tightly packed");
+
+class IndirectBuffer : public Buffer {
+public:
+    virtual ~IndirectBuffer() = default;
+    // NOTE: first is the index of the first command to overwrite
+    virtual void SubmitData(const DrawIndexedIndirectCommand* commands, uint32_t count, uint32_t first = 0) = 0;
+    [[nodiscard]] virtual uint32_t GetCapacity() const = 0;
+
+    static Shared<IndirectBuffer> Create(uint32_t capacity);
+};
+
 } // namespace forge
 
 #endif
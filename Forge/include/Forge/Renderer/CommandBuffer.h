@@ -0,0 +1,67 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+
+#include "Forge/Renderer/RenderQueue.h"
+#include "Forge/Utils/ThreadPool.h"
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace forge {
+
+class RenderAPI;
+
+// NOTE: Draw commands recorded by one thread. Storage comes from a monotonic arena that is
+// released as a whole on Reset, so recording never touches the global allocator once the
+// first block is warm. Recording only copies data: no GL calls, so it is safe on any
+// thread. Materials must be prepared on the context thread before workers copy their commands.
+class CommandBuffer {
+public:
+    explicit CommandBuffer(size_t arenaSize = 64 * 1024);
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    void Record(const DrawCommand& command);
+    void Reset();
+
+    [[nodiscard]] std::span<const DrawCommand> GetCommands() const noexcept {
+        return m_Commands;
+    }
+
+private:
+    std::vector<std::byte> m_InitialBlock;
+    std::pmr::monotonic_buffer_resource m_Arena;
+    std::pmr::vector<DrawCommand> m_Commands;
+};
+
+// NOTE: One CommandBuffer per partition of the frame (scene partition, LOD bucket, ...),
+// reused from frame to frame. Record fans the partitions out over the thread pool and joins
+// them, Submit hands the results to the RenderAPI queue in partition order so sorting
+// stays deterministic.
+class CommandBufferSet {
+public:
+    using RecordFunction = std::function<void(uint32_t partition, CommandBuffer& commandBuffer)>;
+
+    explicit CommandBufferSet(uint32_t partitionCount, ThreadPool& pool = ThreadPool::Get());
+
+    void Record(const RecordFunction& record);
+    void SubmitTo(RenderAPI& renderAPI);
+
+    [[nodiscard]] uint32_t GetPartitionCount() const noexcept {
+        return static_cast<uint32_t>(m_CommandBuffers.size());
+    }
+
+private:
+    ThreadPool& m_Pool;
+    std::vector<std::unique_ptr<CommandBuffer>> m_CommandBuffers;
+};
+
+} // namespace forge
+
+#endif
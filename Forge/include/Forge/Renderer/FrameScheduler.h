@@ -0,0 +1,92 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include "Forge/Renderer/Window.h"
+#include "Forge/Utils/Common.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace forge {
+
+struct FrameSchedulerDescriptor {
+    // NOTE: 0 leaves the frame rate uncapped, vsync still applies when enabled
+    double maxFrameRate{0.0};
+    // Longest idle wait before the loop wakes up on its own, in seconds
+    double idleTimeout{0.5};
+    bool vsync{true};
+    // Draw every frame even when nothing asked for it, used by benchmark runs
+    bool continuous{false};
+    // NOTE: When set, GetDeltaTime reports this instead of the measured time so replayed
+    // sessions animate the same way on every run
+    double fixedDeltaTime{0.0};
+};
+
+// Times are in milliseconds over the last STATS_WINDOW drawn frames
+struct FrameStats {
+    uint64_t frames{0};
+    uint64_t idleWaits{0};
+    double lastFrameTime{0.0};
+    double averageFrameTime{0.0};
+    double minFrameTime{0.0};
+    double maxFrameTime{0.0};
+    double p99FrameTime{0.0};
+};
+
+// NOTE: Decides when the main loop draws. Frames are drawn while something is animating
+// or after a redraw was requested (input, resize, finished uploads). Otherwise the loop
+// sleeps in Window::WaitEvents until an event arrives, so a still viewport costs nothing.
+// Frame time is measured from BeginFrame to EndFrame, the cap sleeps off what is left.
+class FrameScheduler {
+public:
+    static constexpr uint32_t STATS_WINDOW = 240;
+
+    explicit FrameScheduler(Shared<Window> window, const FrameSchedulerDescriptor& descriptor = {});
+
+    // Marks the view dirty, the next `frames` frames are drawn
+    void RequestRedraw(uint32_t frames = 1) noexcept;
+    // NOTE: Every frame is drawn between the two calls, calls nest
+    void BeginAnimation() noexcept;
+    void EndAnimation() noexcept;
+
+    [[nodiscard]] bool IsIdle() const noexcept;
+
+    // Dispatches window events, waiting for them while idle. Returns true when a frame
+    // should be drawn now, false when the wait ended without anything to draw.
+    [[nodiscard]] bool BeginFrame();
+    void EndFrame();
+
+    // NOTE: Seconds between the starts of the last two drawn frames, clamped so animations
+    // don't jump after the loop was idle
+    [[nodiscard]] double GetDeltaTime() const noexcept {
+        return m_DeltaTime;
+    }
+    [[nodiscard]] FrameStats GetStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double MAX_DELTA_TIME = 0.1;
+
+    Shared<Window> m_Window;
+    FrameSchedulerDescriptor m_Descriptor;
+
+    uint32_t m_PendingRedraws{1};
+    uint32_t m_Animations{0};
+
+    Clock::time_point m_FrameStart;
+    Clock::time_point m_LastFrameStart;
+    double m_DeltaTime{0.0};
+
+    std::array<float, STATS_WINDOW> m_FrameTimes{};
+    uint64_t m_Frames{0};
+    uint64_t m_IdleWaits{0};
+};
+
+} // namespace forge
+
+#endif
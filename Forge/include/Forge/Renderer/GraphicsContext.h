@@ -12,7 +12,7 @@ class Window;
 
 class GraphicsContext {
 public:
-    virtual ~GraphicsContext() = default;
+    virtual ~GraphicsContext();
 
     virtual bool Init() = 0;
     virtual void SwapBuffers() = 0;
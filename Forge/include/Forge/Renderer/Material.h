@@ -0,0 +1,119 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef MATERIAL_H
+#define MATERIAL_H
+
+#include "Forge/Renderer/BufferImpl.h"
+#include "Forge/Renderer/RenderQueue.h"
+#include "Forge/Renderer/Shader.h"
+#include "Forge/Utils/Common.h"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace forge {
+
+// NOTE: Shader plus the values of its uniform blocks. The block layout (bindings, member
+// offsets and std140 strides) comes from reflection, values are written into a CPU shadow
+// of every block and Bind uploads only the ranges that changed since the frame slot was
+// last written. Blocks live in a UniformBuffer ring owned by the material, which is replaced
+// by a larger one when a frame changes the blocks more often than it has room for.
+class Material {
+public:
+    explicit Material(Shared<Shader> shader);
+
+    template <typename T>
+    bool Set(ShaderResourceKey name, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Material values must be trivially copyable");
+        return SetData(name, &value, sizeof(T));
+    }
+
+    // NOTE: Writes a block member by name. Matrices with fewer bytes than the member
+    // (e.g. mat3 into a std140 mat3) are spread over the reflected matrix stride.
+    bool SetData(ShaderResourceKey name, const void* data, uint32_t size);
+
+    // NOTE: Binds the shader and the uniform blocks for the next draw
+    void Bind();
+    // NOTE: Same upload as Bind but records the shader and uniform ranges in a queued draw
+    void Prepare(DrawCommand& command);
+
+    // Stable per material, meant for the material bits of the draw sort key
+    [[nodiscard]] uint16_t GetSortID() const noexcept {
+        return m_SortID;
+    }
+
+    [[nodiscard]] const Shared<Shader>& GetShader() const noexcept {
+        return m_Shader;
+    }
+
+private:
+    struct DirtyRange {
+        uint32_t begin{UINT32_MAX};
+        uint32_t end{0};
+
+        void Add(uint32_t rangeBegin, uint32_t rangeEnd) noexcept {
+            begin = begin < rangeBegin ? begin : rangeBegin;
+            end = end > rangeEnd ? end : rangeEnd;
+        }
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return begin >= end;
+        }
+        void Clear() noexcept {
+            *this = {};
+        }
+    };
+
+    struct UniformBlock {
+        uint32_t binding{0};
+        uint32_t size{0};
+        std::vector<uint8_t> shadow;
+        std::array<DirtyRange, MAX_FRAMES_IN_FLIGHT> dirty;
+        UniformAllocation allocation;
+        // Ring the allocation came from, older rings stay alive while draws reference them
+        UniformBuffer* buffer{nullptr};
+        bool changedSinceUpload{false};
+    };
+
+    struct RetiredBuffer {
+        uint64_t releaseFrame{0};
+        Shared<UniformBuffer> buffer;
+    };
+
+    struct MemberRef {
+        uint32_t block{0};
+        uint32_t offset{0};
+        uint32_t size{0};
+        uint32_t matrixStride{0};
+    };
+
+    void PrepareBlocks();
+    void BuildLayout();
+    void WriteMember(const MemberRef& member, const void* data, uint32_t size);
+    void UploadBlocks();
+    [[nodiscard]] UniformAllocation AllocateBlock(uint32_t size);
+    void RetireUniformBuffer();
+    void ReleaseRetiredBuffers(uint64_t frameIndex);
+
+private:
+    Shared<Shader> m_Shader;
+    Shared<UniformBuffer> m_UniformBuffer;
+    std::vector<RetiredBuffer> m_RetiredBuffers;
+
+    std::vector<UniformBlock> m_Blocks;
+    std::unordered_map<uint64_t, MemberRef> m_Members;
+    // NOTE: Every value ever set, used to refill the shadows when the layout is rebuilt
+    // (an async shader reports the fallback's layout until it is ready)
+    std::unordered_map<uint64_t, std::vector<uint8_t>> m_Values;
+
+    uint16_t m_SortID{0};
+    bool m_LayoutBuilt{false};
+    bool m_LayoutFinal{false};
+    uint64_t m_UploadFrame{UINT64_MAX};
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,115 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef MESHBATCH_H
+#define MESHBATCH_H
+
+#include "Forge/Renderer/BufferHeap.h"
+#include "Forge/Renderer/BufferImpl.h"
+#include "Forge/Utils/Common.h"
+#include "Forge/Utils/Math.h"
+#include <cstdint>
+#include <vector>
+
+namespace forge {
+
+class Material;
+class RenderAPI;
+
+using MeshID = uint32_t;
+using BatchDrawID = uint32_t;
+inline constexpr uint32_t INVALID_BATCH_INDEX = UINT32_MAX;
+
+// NOTE: Static meshes sharing one vertex layout, sub-allocated from a one page vertex and index
+// BufferHeap and drawn with one indirect call. Meshes can be removed again, Defragment compacts
+// the freed holes and patches the commands. Every draw is one command in the indirect buffer and one
+// mat4 in a storage buffer, the vertex shader picks its transform with gl_DrawID:
+//
+//   layout(std430, binding = 0) readonly buffer Transforms { mat4 u_Transforms[]; };
+//   gl_Position = u_ViewProjection * u_Transforms[gl_DrawID] * vec4(a_Position, 1.0);
+//
+// baseInstance carries the draw index too, for per draw vertex attributes with a divisor.
+// Commands and transforms are only uploaded when they change.
+class MeshBatch {
+public:
+    MeshBatch(const BufferLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity, uint32_t drawCapacity,
+              uint32_t transformBinding = 0);
+
+    // NOTE: Copies the geometry into the shared buffers, indices are relative to the mesh's
+    // own vertices. Returns INVALID_BATCH_INDEX when the batch is full.
+    MeshID AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+    // NOTE: Draws of the mesh have to be cleared first, its id is not reused
+    void RemoveMesh(MeshID mesh);
+    // NOTE: Returns the bytes moved, see BufferHeap::Defragment
+    uint64_t Defragment(float threshold = 0.25f);
+
+    BatchDrawID AddDraw(MeshID mesh, const math::mat4f& transform);
+    void SetTransform(BatchDrawID draw, const math::mat4f& transform);
+    void ClearDraws();
+
+    // NOTE: Binds the material and issues every draw of the batch in one call
+    void Draw(RenderAPI& renderAPI, Material& material);
+
+    [[nodiscard]] uint32_t GetMeshCount() const noexcept {
+        return static_cast<uint32_t>(m_Meshes.size());
+    }
+    [[nodiscard]] uint32_t GetDrawCount() const noexcept {
+        return static_cast<uint32_t>(m_Commands.size());
+    }
+    // NOTE: Null until the first mesh is added, the vertex heap has no page before that
+    [[nodiscard]] const Shared<VertexArrayBuffer>& GetVertexArray() const noexcept {
+        return m_VertexArray;
+    }
+
+private:
+    struct MeshRange {
+        BufferHeapHandle vertices;
+        BufferHeapHandle indices;
+        uint32_t firstIndex{0};
+        uint32_t indexCount{0};
+        int32_t baseVertex{0};
+    };
+
+    struct DirtyRange {
+        uint32_t begin{UINT32_MAX};
+        uint32_t end{0};
+
+        void Add(uint32_t index) noexcept {
+            begin = begin < index ? begin : index;
+            end = end > index + 1 ? end : index + 1;
+        }
+        [[nodiscard]] bool IsEmpty() const noexcept {
+            return begin >= end;
+        }
+        void Clear() noexcept {
+            *this = {};
+        }
+    };
+
+    void ResolveMesh(MeshRange& range) const;
+    void UploadDirty();
+
+private:
+    BufferLayout m_Layout;
+    BufferHeap m_VertexHeap;
+    BufferHeap m_IndexHeap;
+    Shared<VertexArrayBuffer> m_VertexArray;
+    Shared<IndirectBuffer> m_IndirectBuffer;
+    Shared<StorageBuffer> m_TransformBuffer;
+
+    std::vector<MeshRange> m_Meshes;
+    std::vector<DrawIndexedIndirectCommand> m_Commands;
+    std::vector<MeshID> m_DrawMeshes;
+    std::vector<math::mat4f> m_Transforms;
+    DirtyRange m_DirtyCommands;
+    DirtyRange m_DirtyTransforms;
+
+    uint32_t m_VertexStride{0};
+    uint32_t m_VertexAlignment{0};
+    uint32_t m_DrawCapacity{0};
+    uint32_t m_TransformBinding{0};
+};
+
+} // namespace forge
+
+#endif
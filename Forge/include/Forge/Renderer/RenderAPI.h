@@ -4,6 +4,9 @@
 #ifndef RENDERAPI_H
 #define RENDERAPI_H
 
+#include "Forge/Renderer/BufferImpl.h"
+#include "Forge/Renderer/CommandBuffer.h"
+#include "Forge/Renderer/RenderQueue.h"
 #include "Forge/Utils/Common.h"
 #include "Forge/Utils/Math.h"
 #include "Forge/Utils/Platform.h"
@@ -34,22 +37,66 @@ class RenderAPI {
 public:
     virtual ~RenderAPI() = default;
 
+    // NOTE: Frame pacing. BeginFrame waits until the GPU finished the frame that last used the
+    // current frame slot, EndFrame marks the end of the submitted work and advances the slot
+    virtual void BeginFrame() = 0;
+    virtual void EndFrame() = 0;
+
     virtual void Clear(const ClearState& state) = 0;
-    //
-    // NOTE: Other virtual functions define here
-    //
+
+    // NOTE: Draws indexed triangles, an indexCount of 0 draws the whole index buffer
+    virtual void DrawIndexed(const Shared<VertexArrayBuffer>& vertexArray, uint32_t indexCount = 0) = 0;
+    // NOTE: Draws instanceCount copies in one call, per instance data comes from vertex
+    // buffers whose layout has a divisor
+    virtual void DrawIndexedInstanced(const Shared<VertexArrayBuffer>& vertexArray, uint32_t instanceCount,
+                                      uint32_t indexCount = 0) = 0;
+    // NOTE: Issues drawCount commands read from the indirect buffer in one call, starting at
+    // command firstDraw. Shaders see the command index as gl_DrawID
+    virtual void DrawIndexedIndirect(const Shared<VertexArrayBuffer>& vertexArray, const Shared<IndirectBuffer>& indirectBuffer,
+                                     uint32_t drawCount, uint32_t firstDraw = 0) = 0;
+
+    // NOTE: Queued submission. Submit only records the draw, Flush sorts the queue by key and
+    // issues it, binding shaders, vertex arrays and uniform ranges only when they change
+    void Submit(const DrawCommand& command);
+    // NOTE: Context thread only, the command buffer may have been recorded on any thread
+    void Submit(const CommandBuffer& commandBuffer);
+    void Flush();
+
+    [[nodiscard]] const RenderQueueStats& GetQueueStats() const noexcept {
+        return m_QueueStats;
+    }
 
     // Factory method
     static Shared<RenderAPI> Create();
+    // NOTE: Releases the backend objects of the instance, called by GraphicsContext on
+    // destruction while the context is still current
+    static void Shutdown();
 
     static GraphicsAPI GetAPI() {
         return PlatformAPI::GetSelectedGraphicsAPI();
     }
 
+    [[nodiscard]] static uint64_t GetFrameIndex() noexcept {
+        return s_FrameIndex;
+    }
+    [[nodiscard]] static uint32_t GetFrameSlot() noexcept {
+        return static_cast<uint32_t>(s_FrameIndex % MAX_FRAMES_IN_FLIGHT);
+    }
+
 private:
     static Shared<RenderAPI> s_Instance;
 
 protected:
+    // NOTE: Issues only the draw call, Flush has bound the state it needs
+    virtual void SubmitDraw(const DrawCommand& command) = 0;
+    virtual void ReleaseResources() {}
+
+    // NOTE: Advanced by the backend EndFrame
+    static uint64_t s_FrameIndex;
+
+    RenderQueue m_Queue;
+    RenderQueueStats m_QueueStats;
+
     RenderAPI() = default;
 
     // NOTE: Delete copy operations
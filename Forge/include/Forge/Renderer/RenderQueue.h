@@ -0,0 +1,83 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include "Forge/Renderer/BufferImpl.h"
+#include "Forge/Renderer/Shader.h"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace forge {
+
+inline constexpr uint32_t MAX_DRAW_UNIFORM_BINDINGS = 4;
+inline constexpr uint32_t MAX_UNIFORM_BINDING_SLOTS = 16;
+
+struct UniformBinding {
+    const UniformBuffer* buffer{nullptr};
+    UniformAllocation allocation;
+    uint32_t binding{0};
+
+    [[nodiscard]] bool operator==(const UniformBinding& other) const noexcept {
+        return buffer == other.buffer && allocation.offset == other.allocation.offset &&
+               allocation.size == other.allocation.size && binding == other.binding;
+    }
+};
+
+// NOTE: Everything needed for one draw. Resources are referenced, not owned, and must stay
+// alive until the queue is flushed. An indexCount of 0 draws the whole index buffer.
+struct DrawCommand {
+    uint64_t sortKey{0};
+    const Shader* shader{nullptr};
+    const VertexArrayBuffer* vertexArray{nullptr};
+    uint32_t indexCount{0};
+    uint32_t firstIndex{0};
+    // Added to every index, lets geometry sub-allocated from a BufferHeap page share one vertex array
+    int32_t baseVertex{0};
+    uint32_t instanceCount{1};
+
+    uint32_t uniformCount{0};
+    std::array<UniformBinding, MAX_DRAW_UNIFORM_BINDINGS> uniforms;
+
+    void AddUniform(const UniformBuffer* buffer, const UniformAllocation& allocation, uint32_t binding) noexcept;
+};
+
+// NOTE: Sort key layout, most significant first: 16 bit pipeline (shader), 16 bit material,
+// 32 bit depth. Draws of the same pipeline and material end up adjacent, then front to back.
+// The first two are meant to come from Shader::GetSortID and Material::GetSortID.
+[[nodiscard]] uint64_t MakeDrawSortKey(uint16_t pipeline, uint16_t material, float depth) noexcept;
+
+struct RenderQueueStats {
+    uint32_t draws{0};
+    uint32_t shaderBinds{0};
+    uint32_t vertexArrayBinds{0};
+    uint32_t uniformBinds{0};
+    uint32_t redundantBindsSkipped{0};
+};
+
+class RenderQueue {
+public:
+    RenderQueue() = default;
+
+    void Submit(const DrawCommand& command);
+    void Submit(std::span<const DrawCommand> commands);
+    void Sort();
+    void Clear();
+
+    [[nodiscard]] std::span<const DrawCommand> GetCommands() const noexcept {
+        return m_Commands;
+    }
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return m_Commands.empty();
+    }
+
+private:
+    std::vector<DrawCommand> m_Commands;
+};
+
+} // namespace forge
+
+#endif
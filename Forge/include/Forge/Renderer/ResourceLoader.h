@@ -0,0 +1,88 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef RESOURCELOADER_H
+#define RESOURCELOADER_H
+
+#include "Forge/Renderer/BufferImpl.h"
+#include "Forge/Renderer/Window.h"
+#include "Forge/Utils/Common.h"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace forge {
+
+struct ResourceLoaderStats {
+    uint64_t jobsLoaded{0};
+    uint64_t jobsFailed{0};
+    uint64_t jobsPublished{0};
+};
+
+// NOTE: Creates GPU resources off the render thread. The load half of a job runs on a
+// loader thread that owns a context sharing objects with the main one, so buffers can be
+// created and filled there while the render loop keeps drawing. Once the GPU finished
+// the load its ready half runs on the render thread, from Poll, with the load result.
+//
+// Only shareable objects may be made in the load half: buffers yes, vertex arrays no,
+// they belong to the context that created them and are built in the ready half. Stream
+// buffer writes (SubmitData, BeginWrite) go through the render thread's staging ring and
+// are not allowed on the loader either, create the buffers with their initial data.
+class ResourceLoader {
+public:
+    using LoadFn = std::function<bool()>;
+    using ReadyFn = std::function<void()>;
+    using VertexBufferReadyFn = std::function<void(Shared<VertexBuffer>)>;
+    using IndexBufferReadyFn = std::function<void(Shared<IndexBuffer>)>;
+
+    virtual ~ResourceLoader() = default;
+
+    // `load` returns the loaded resources, `ready` receives them by rvalue on the render thread
+    template <typename Load, typename Ready>
+    void Submit(Load&& load, Ready&& ready) {
+        using ResultType = std::invoke_result_t<Load>;
+
+        struct Job {
+            std::decay_t<Load> load;
+            std::decay_t<Ready> ready;
+            std::optional<ResultType> result;
+        };
+
+        // NOTE: Shared by the two halves so move-only results and callables are fine
+        auto job = std::make_shared<Job>(Job{std::forward<Load>(load), std::forward<Ready>(ready), std::nullopt});
+        Enqueue(
+            [job]() {
+                job->result.emplace(job->load());
+                return true;
+            },
+            [job]() {
+                job->ready(std::move(*job->result));
+            });
+    }
+
+    // NOTE: Create a buffer from owned data on the loader thread. The data lives in the job
+    // until it was published, `ready` gets null when the buffer could not be created. Index
+    // data sizes have to be a multiple of 4 bytes.
+    void UploadVertexBuffer(BufferData&& data, BufferDrawMode mode, VertexBufferReadyFn ready);
+    void UploadIndexBuffer(BufferData&& data, BufferDrawMode mode, IndexBufferReadyFn ready);
+
+    // NOTE: Publishes finished jobs, called once per frame on the render thread
+    virtual void Poll() = 0;
+
+    [[nodiscard]] virtual uint32_t GetPendingCount() const noexcept = 0;
+    [[nodiscard]] virtual const ResourceLoaderStats& GetStats() const noexcept = 0;
+
+    // NOTE: Must be created and destroyed on the render thread while its context is alive
+    [[nodiscard]] static Unique<ResourceLoader> Create(const Shared<Window>& window);
+
+protected:
+    // `load` returns false when it failed, its `ready` is dropped then
+    virtual void Enqueue(LoadFn load, ReadyFn ready) = 0;
+};
+
+} // namespace forge
+
+#endif
@@ -5,8 +5,10 @@
 #define SHADER_H
 
 #include "Forge/Utils/Common.h"
+#include "Forge/Utils/Hash.h"
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace forge {
@@ -28,6 +30,15 @@ enum class ShaderOrigin : uint8_t {
 
 enum class ShaderResourceType { UniformBuffer, StorageBuffer, Sampler, Input, Output, Unknown };
 
+// NOTE: Layout of one block member as declared in the shader (std140 for uniform blocks)
+struct ShaderResourceMember {
+    std::string name;
+    uint32_t offset{0};
+    uint32_t size{0};
+    uint32_t arrayStride{0};  // 0 when the member is not an array
+    uint32_t matrixStride{0}; // 0 when the member is not a matrix
+};
+
 struct ShaderResource {
     uint32_t binding{0};
     uint32_t location{0};
@@ -36,6 +47,27 @@ struct ShaderResource {
     ShaderResourceType type{ShaderResourceType::Unknown};
     uint32_t size{0};
     uint32_t memberCount{0};
+    std::vector<ShaderResourceMember> members;
+};
+
+// NOTE: Hashed resource name used by the lookups. Strings convert implicitly without
+// allocating, hot paths should keep a precomputed one (e.g. static constexpr). The key only
+// views the name, which is compared on a hash hit, so the string must outlive the key.
+struct ShaderResourceKey {
+    uint64_t hash{0};
+    std::string_view name;
+
+    constexpr ShaderResourceKey(std::string_view name) noexcept
+        : hash(HashString(name))
+        , name(name) {}
+    constexpr ShaderResourceKey(const char* name) noexcept
+        : hash(HashString(name))
+        , name(name) {}
+    ShaderResourceKey(const std::string& name) noexcept
+        : hash(HashString(name))
+        , name(name) {}
+
+    constexpr bool operator==(const ShaderResourceKey&) const noexcept = default;
 };
 
 // NOTE: Base shader interface
@@ -53,18 +85,37 @@ public:
     [[nodiscard]] virtual const std::vector<ShaderResource>& GetStageInputs() const noexcept = 0;
     [[nodiscard]] virtual const std::vector<ShaderResource>& GetStageOutputs() const noexcept = 0;
 
-    [[nodiscard]] virtual bool HasUniformBuffer(const std::string& name) const noexcept = 0;
-    [[nodiscard]] virtual bool HasStorageBuffer(const std::string& name) const noexcept = 0;
-    [[nodiscard]] virtual bool HasSampler(const std::string& name) const noexcept = 0;
+    [[nodiscard]] virtual bool HasUniformBuffer(ShaderResourceKey name) const noexcept = 0;
+    [[nodiscard]] virtual bool HasStorageBuffer(ShaderResourceKey name) const noexcept = 0;
+    [[nodiscard]] virtual bool HasSampler(ShaderResourceKey name) const noexcept = 0;
 
-    [[nodiscard]] virtual const ShaderResource* FindResource(const std::string& name) const noexcept = 0;
+    [[nodiscard]] virtual const ShaderResource* FindResource(ShaderResourceKey name) const noexcept = 0;
     [[nodiscard]] virtual const ShaderResource* FindResourceByBinding(uint32_t binding, uint32_t set = 0) const noexcept = 0;
 
+    // NOTE: Only shaders from CreateAsync can be not ready yet
+    [[nodiscard]] virtual bool IsReady() const noexcept {
+        return true;
+    }
+
+    // Stable per shader, meant for the pipeline bits of the draw sort key
+    [[nodiscard]] uint16_t GetSortID() const noexcept {
+        return m_SortID;
+    }
+
     // NOTE: Factory method to create appropriate shader type
     [[nodiscard]] static Shared<Shader> Create(const std::string& data, const ShaderOrigin origin = ShaderOrigin::File) noexcept;
 
+    // NOTE: Generates the SPIR-V of all shaders in parallel, then creates the programs
+    // on the calling thread. Results keep the order of the input, failures are nullptr.
+    [[nodiscard]] static std::vector<Shared<Shader>> CreateBatch(const std::vector<std::string>& data,
+                                                                 const ShaderOrigin origin = ShaderOrigin::File) noexcept;
+
+    // NOTE: Returns immediately, SPIR-V generation, translation and reflection run on the
+    // thread pool. Until IsReady() the returned shader binds a fallback program.
+    [[nodiscard]] static Shared<Shader> CreateAsync(const std::string& data, const ShaderOrigin origin = ShaderOrigin::File) noexcept;
+
 protected:
-    Shader() = default;
+    Shader();
 
     // NOTE: Delete copy operations
     Shader(const Shader&) = delete;
@@ -73,6 +124,9 @@ protected:
     // NOTE: Allow move operations
     Shader(Shader&&) noexcept = default;
     Shader& operator=(Shader&&) noexcept = default;
+
+private:
+    uint16_t m_SortID{0};
 };
 
 constexpr std::string GetShaderTypeName(ShaderType type) {
@@ -0,0 +1,85 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ASYNCSHADER_H
+#define ASYNCSHADER_H
+
+#include "Forge/Renderer/Shader.h"
+#include "Forge/Renderer/Shader/ShaderCompiler.h"
+#include "Forge/Utils/Common.h"
+#include <future>
+
+namespace forge {
+
+enum class ShaderBuildStatus : uint8_t {
+    Pending,
+    Ready,
+    Failed,
+};
+
+// NOTE: Backend half of an asynchronous shader build. Prepare runs on a pool worker and may
+// only touch CPU data (translation, reflection), Poll runs on the context thread and issues
+// the API calls. Poll is called every frame until it stops returning Pending.
+class ShaderBuildTask {
+public:
+    virtual ~ShaderBuildTask() = default;
+
+    [[nodiscard]] virtual bool Prepare(ShaderSPIRVMap& spirvBinaries) = 0;
+    [[nodiscard]] virtual ShaderBuildStatus Poll(Shared<Shader>& outShader) = 0;
+
+    [[nodiscard]] static Unique<ShaderBuildTask> Create() noexcept;
+};
+
+// NOTE: Handle returned by Shader::CreateAsync. Forwards to the real shader once it is
+// built and binds (and reflects) a shared fallback program until then. Bind, IsReady and
+// the reflection queries advance the build, so they must be called on the context thread.
+class AsyncShader final : public Shader {
+public:
+    AsyncShader(ShaderCompileRequest request, Unique<ShaderBuildTask> task) noexcept;
+    ~AsyncShader() override;
+
+    void Bind() const override;
+    void UnBind() const override;
+
+    [[nodiscard]] bool IsReady() const noexcept override;
+    [[nodiscard]] ShaderBuildStatus GetStatus() const noexcept;
+
+    // Reflection interface, describes the fallback until the shader is ready
+    [[nodiscard]] const std::vector<ShaderResource>& GetUniformBuffers() const noexcept override;
+    [[nodiscard]] const std::vector<ShaderResource>& GetStorageBuffers() const noexcept override;
+    [[nodiscard]] const std::vector<ShaderResource>& GetSamplers() const noexcept override;
+    [[nodiscard]] const std::vector<ShaderResource>& GetStageInputs() const noexcept override;
+    [[nodiscard]] const std::vector<ShaderResource>& GetStageOutputs() const noexcept override;
+
+    [[nodiscard]] bool HasUniformBuffer(ShaderResourceKey name) const noexcept override;
+    [[nodiscard]] bool HasStorageBuffer(ShaderResourceKey name) const noexcept override;
+    [[nodiscard]] bool HasSampler(ShaderResourceKey name) const noexcept override;
+
+    [[nodiscard]] const ShaderResource* FindResource(ShaderResourceKey name) const noexcept override;
+    [[nodiscard]] const ShaderResource* FindResourceByBinding(uint32_t binding, uint32_t set = 0) const noexcept override;
+
+    // NOTE: Called by GraphicsContext on creation and destruction, the context must be current
+    static void CreateFallbackShader() noexcept;
+    static void DestroyFallbackShader() noexcept;
+
+private:
+    void Poll() const noexcept;
+    [[nodiscard]] const Shader* GetBoundShader() const noexcept;
+
+private:
+    struct BuildResult {
+        std::string name;
+        bool prepared{false};
+    };
+
+    // NOTE: Used in logs only, never the shader source
+    mutable std::string m_Name;
+    Unique<ShaderBuildTask> m_Task;
+    mutable std::future<BuildResult> m_Job;
+    mutable Shared<Shader> m_Shader;
+    mutable ShaderBuildStatus m_Status{ShaderBuildStatus::Pending};
+};
+
+} // namespace forge
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef SHADERCACHE_H
+#define SHADERCACHE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace forge {
+
+// NOTE: Content addressed SPIR-V cache. Every binary is stored as <key>.spv where
+// the key hashes the preprocessed source, the compile options and the stage.
+// A single index file lists the known keys so lookups never stat the disk.
+// Safe to use from the shader compile jobs concurrently.
+class ShaderCache {
+public:
+    static ShaderCache& Get();
+
+    [[nodiscard]] std::optional<std::vector<uint32_t>> Load(uint64_t key);
+    void Store(uint64_t key, const std::vector<uint32_t>& spirv, const std::string& label);
+
+private:
+    ShaderCache() = default;
+
+    // NOTE: All three expect m_Mutex to be held
+    void LoadIndex();
+    void RewriteIndex();
+    void AppendToIndex(uint64_t key, size_t size, const std::string& label);
+    std::filesystem::path GetBinaryPath(uint64_t key) const;
+    static std::string GetTempSuffix();
+
+    struct Entry {
+        size_t size{0};
+        std::string label;
+    };
+
+    std::filesystem::path m_CachePath;
+    std::unordered_map<uint64_t, Entry> m_Index;
+    bool m_IndexLoaded{false};
+    std::mutex m_Mutex;
+};
+
+} // namespace forge
+
+#endif
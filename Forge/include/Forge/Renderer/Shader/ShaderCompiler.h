@@ -0,0 +1,61 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef SHADERCOMPILER_H
+#define SHADERCOMPILER_H
+
+#include "Forge/Renderer/Shader.h"
+#include "Forge/Utils/ThreadPool.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace forge {
+
+using ShaderSPIRVMap = std::unordered_map<ShaderType, std::vector<uint32_t>>;
+
+struct ShaderCompileRequest {
+    std::string data;
+    ShaderOrigin origin{ShaderOrigin::File};
+};
+
+// NOTE: spirv is empty when any stage of the shader failed to compile
+struct ShaderCompileResult {
+    std::string name;
+    ShaderSPIRVMap spirv;
+};
+
+struct ShaderCompileStats {
+    uint32_t shaderCount{0};
+    uint32_t stageCount{0};
+    uint32_t cacheHits{0};
+    double milliseconds{0.0};
+};
+
+// NOTE: Job based front end of the SPIR-V pipeline. Every request is parsed on its own
+// job, then every stage of every request is preprocessed, looked up in the ShaderCache
+// and compiled on its own job. Compile() joins all of them before returning, so the
+// backend program creation still runs on the calling (context) thread.
+class ShaderCompiler {
+public:
+    explicit ShaderCompiler(ThreadPool& pool = ThreadPool::Get());
+
+    [[nodiscard]] std::vector<ShaderCompileResult> Compile(const std::vector<ShaderCompileRequest>& requests);
+
+    // NOTE: Same pipeline on the calling thread only, meant for code that already runs
+    // on a pool worker and must not block it on nested jobs
+    [[nodiscard]] static ShaderCompileResult CompileImmediate(const ShaderCompileRequest& request);
+
+    [[nodiscard]] const ShaderCompileStats& GetLastStats() const noexcept {
+        return m_LastStats;
+    }
+
+private:
+    ThreadPool& m_Pool;
+    ShaderCompileStats m_LastStats;
+};
+
+} // namespace forge
+
+#endif
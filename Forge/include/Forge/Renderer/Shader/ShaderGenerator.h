@@ -7,22 +7,44 @@
 #include "Forge/Renderer/Shader.h"
 #include "Forge/Utils/ErrorCodes.h"
 #include <cstdint>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <shaderc/shaderc.hpp>
 
 namespace forge {
 
+struct ShaderCompileOptions {
+    // Like -DMY_DEFINE=1
+    std::vector<std::pair<std::string, std::string>> macros{{"MY_DEFINE", "1"}};
+    shaderc_optimization_level optimizationLevel{shaderc_optimization_level_size};
+};
+
 class ShaderSPIRVGenerator {
 public:
-    ShaderSPIRVGenerator() = default;
+    explicit ShaderSPIRVGenerator(ShaderCompileOptions options = {});
     ~ShaderSPIRVGenerator() = default;
 
     ErrorResult Generate(const std::unordered_map<ShaderType, std::string>& shadersSource, std::string name,
                          std::vector<uint32_t>& shaderSpirvBinary) noexcept;
 
+    // NOTE: Runs only the preprocessor, its output is what the SPIR-V cache is keyed on
+    ErrorResult Preprocess(const std::string& source, ShaderType type, const std::string& name, std::string& out_source) noexcept;
+
+    // Hash of everything besides the source that changes the generated SPIR-V:
+    // macros, optimization level and compiler version
+    [[nodiscard]] uint64_t GetOptionsHash() const noexcept {
+        return m_OptionsHash;
+    }
+
 private:
     shaderc_shader_kind ToShadercType(ShaderType type);
+    shaderc::CompileOptions MakeCompileOptions() const;
+
+    ShaderCompileOptions m_Options;
+    uint64_t m_OptionsHash{0};
 };
 
 } // namespace forge
@@ -0,0 +1,87 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef SHADERREFLECTION_H
+#define SHADERREFLECTION_H
+
+#include "Forge/Renderer/Shader.h"
+#include "Forge/Utils/Hash.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace spirv_cross {
+class Compiler;
+}
+
+namespace forge {
+
+// NOTE: Backend independent storage of the resources reflected from SPIR-V,
+// shared by every Shader implementation. Name and (set, binding) lookups go through
+// hash tables built once per Reflect call. A name hit is confirmed with one string compare,
+// only a hash collision falls back to scanning the collection.
+class ShaderReflection {
+public:
+    ShaderReflection() = default;
+
+    // NOTE: Takes an already parsed module so backends that also emit code from it
+    // (e.g. CompilerGLSL) parse every stage only once
+    void Reflect(const spirv_cross::Compiler& compiler, ShaderType type);
+    void Reflect(const std::vector<uint32_t>& spirv, ShaderType type);
+
+    [[nodiscard]] const std::vector<ShaderResource>& GetUniformBuffers() const noexcept {
+        return m_UniformBuffers;
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetStorageBuffers() const noexcept {
+        return m_StorageBuffers;
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetSamplers() const noexcept {
+        return m_Samplers;
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetStageInputs() const noexcept {
+        return m_StageInputs;
+    }
+    [[nodiscard]] const std::vector<ShaderResource>& GetStageOutputs() const noexcept {
+        return m_StageOutputs;
+    }
+
+    [[nodiscard]] bool HasUniformBuffer(ShaderResourceKey name) const noexcept;
+    [[nodiscard]] bool HasStorageBuffer(ShaderResourceKey name) const noexcept;
+    [[nodiscard]] bool HasSampler(ShaderResourceKey name) const noexcept;
+
+    [[nodiscard]] const ShaderResource* FindResource(ShaderResourceKey name) const noexcept;
+    [[nodiscard]] const ShaderResource* FindResourceByBinding(uint32_t binding, uint32_t set = 0) const noexcept;
+
+private:
+    // NOTE: Indices instead of pointers so the tables survive copies of the reflection
+    struct ResourceRef {
+        ShaderResourceType type{ShaderResourceType::Unknown};
+        uint32_t index{0};
+    };
+
+    void BuildIndex();
+    [[nodiscard]] const ShaderResource* FindInIndex(ShaderResourceKey name, ShaderResourceType type) const noexcept;
+    [[nodiscard]] const std::vector<ShaderResource>& GetCollection(ShaderResourceType type) const noexcept;
+
+    [[nodiscard]] static constexpr uint64_t MakeNameKey(uint64_t nameHash, ShaderResourceType type) noexcept {
+        return HashCombine(nameHash, static_cast<uint64_t>(type));
+    }
+    [[nodiscard]] static constexpr uint64_t MakeBindingKey(uint32_t binding, uint32_t set) noexcept {
+        return (static_cast<uint64_t>(set) << 32) | binding;
+    }
+
+private:
+    std::vector<ShaderResource> m_UniformBuffers;
+    std::vector<ShaderResource> m_Samplers;
+    std::vector<ShaderResource> m_StorageBuffers;
+    std::vector<ShaderResource> m_StageInputs;
+    std::vector<ShaderResource> m_StageOutputs;
+
+    std::unordered_map<uint64_t, ResourceRef> m_NameIndex;
+    std::unordered_map<uint64_t, ResourceRef> m_BindingIndex;
+};
+
+} // namespace forge
+
+#endif
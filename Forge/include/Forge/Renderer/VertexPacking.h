@@ -0,0 +1,40 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef VERTEXPACKING_H
+#define VERTEXPACKING_H
+
+#include "Forge/Utils/Math.h"
+#include <array>
+#include <cstdint>
+
+namespace forge {
+
+// NOTE: CPU side quantization into the compact BufferDataType formats. Values are clamped
+// to the representable range and rounded to nearest, so a packed value read back by the
+// GPU is the closest one the format can hold.
+
+// IEEE half float, round to nearest even, overflows to infinity (Half2, Half4)
+[[nodiscard]] uint16_t PackHalf(float value) noexcept;
+[[nodiscard]] float UnpackHalf(uint16_t value) noexcept;
+[[nodiscard]] std::array<uint16_t, 2> PackHalf2(const math::vec2f& value) noexcept;
+[[nodiscard]] std::array<uint16_t, 4> PackHalf4(const math::vec4f& value) noexcept;
+
+// [0, 1] and [-1, 1] into 8 bits per component, x in the lowest byte (UByte4Norm, Byte4Norm)
+[[nodiscard]] uint32_t PackUnorm4x8(const math::vec4f& value) noexcept;
+[[nodiscard]] uint32_t PackSnorm4x8(const math::vec4f& value) noexcept;
+
+// [0, 1] and [-1, 1] into 16 bits per component (UShort2Norm, Short2Norm, Short4Norm)
+[[nodiscard]] std::array<uint16_t, 2> PackUnorm2x16(const math::vec2f& value) noexcept;
+[[nodiscard]] std::array<int16_t, 2> PackSnorm2x16(const math::vec2f& value) noexcept;
+[[nodiscard]] std::array<int16_t, 4> PackSnorm4x16(const math::vec4f& value) noexcept;
+
+// x, y, z in 10 bits and w in 2 bits (Int2_10_10_10_Rev, UInt2_10_10_10_Rev). The signed
+// variant is the usual choice for normals and tangents (w carries the bitangent sign).
+[[nodiscard]] uint32_t PackSnorm3x10_1x2(const math::vec4f& value) noexcept;
+[[nodiscard]] uint32_t PackUnorm3x10_1x2(const math::vec4f& value) noexcept;
+[[nodiscard]] uint32_t PackNormal(const math::vec3f& normal) noexcept;
+
+} // namespace forge
+
+#endif
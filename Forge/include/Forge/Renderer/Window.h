@@ -14,6 +14,10 @@ namespace forge {
 
 // Forward declaration for Event class
 class Event;
+class EventQueue;
+class EventRecorder;
+class EventPlayer;
+struct EventRecord;
 
 struct WindowDescriptor {
     uint32_t width;
@@ -34,24 +38,43 @@ struct WindowDescriptor {
 class Window {
 public:
     using EventCallbackFn = std::function<void(Event&)>;
-    virtual ~Window() = default;
+    virtual ~Window();
 
     // Core window operations
     virtual void* GetNativeWindow() const = 0;
     virtual void EnableVSync(bool enable) = 0;
     virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
     virtual void Update() = 0;
+    // NOTE: Like Update but sleeps until an event arrives or `timeout` seconds passed
+    virtual void WaitEvents(double timeout) = 0;
 
     virtual uint32_t GetWidth() const = 0;
     virtual uint32_t GetHeight() const = 0;
     virtual bool IsVSyncEnabled() const = 0;
     virtual bool IsFullscreen() const = 0;
 
+    // NOTE: Writes every dispatched event to a binary file until the window is destroyed
+    bool StartRecording(const std::string& path);
+    // NOTE: Replaces the window's input with a recording, played back frame by frame. Live
+    // input is ignored apart from close requests, a close event follows the last record.
+    bool StartReplay(const std::string& path);
+    [[nodiscard]] bool IsReplaying() const noexcept {
+        return m_Player != nullptr;
+    }
+
     // Factory method
     static Shared<Window> Create(const WindowDescriptor& descriptor = WindowDescriptor());
 
 protected:
-    Window() = default;
+    Window();
+
+    using SendEventFn = std::function<void(const EventRecord&)>;
+
+    // NOTE: Backends drain their queue through here so recording and replay work the same
+    // everywhere, `send` turns a record into an event for the callback
+    void ProcessEvents(EventQueue& queue, const SendEventFn& send);
+    // Builds the window, key or mouse event a record describes and hands it to `callback`
+    static void SendEvent(const EventRecord& record, const EventCallbackFn& callback);
 
     // NOTE: Delete copy operations
     Window(const Window&) = delete;
@@ -60,6 +83,11 @@ protected:
     // NOTE: Allow move operations
     Window(Window&&) noexcept = default;
     Window& operator=(Window&&) noexcept = default;
+
+private:
+    Unique<EventRecorder> m_Recorder;
+    Unique<EventPlayer> m_Player;
+    bool m_ReplayClosed{false};
 };
 } // namespace forge
 
@@ -0,0 +1,54 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace forge {
+
+inline constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+inline constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+// NOTE: 64-bit FNV-1a, constexpr so names can be hashed at compile time
+[[nodiscard]] constexpr uint64_t HashString(std::string_view data, uint64_t seed = FNV_OFFSET_BASIS) noexcept {
+    uint64_t hash = seed;
+    for (char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+[[nodiscard]] inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = FNV_OFFSET_BASIS) noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+[[nodiscard]] constexpr uint64_t HashCombine(uint64_t seed, uint64_t value) noexcept {
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 12) + (seed >> 4));
+}
+
+// Fixed width lowercase hex, used for cache file names
+[[nodiscard]] inline std::string HashToHex(uint64_t hash) {
+    constexpr char digits[] = "0123456789abcdef";
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; i--) {
+        hex[i] = digits[hash & 0xf];
+        hash >>= 4;
+    }
+    return hex;
+}
+
+} // namespace forge
+
+#endif
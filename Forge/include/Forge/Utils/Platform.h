@@ -12,7 +12,7 @@ namespace forge {
 // Forward declarations of enum classes
 enum class Platform { Windows, Linux, MacOS, iOS, Android, WebGL, Unknown };
 
-enum class GraphicsAPI { OpenGL, Vulkan, DirectX12, Metal, WebGL, None };
+enum class GraphicsAPI { OpenGL, Vulkan, DirectX12, Metal, WebGL, Null, None };
 
 class PlatformAPI {
 public:
@@ -55,6 +55,9 @@ public:
         if (IsGraphicsAPISupported(GraphicsAPI::WebGL))
             availableAPIs.push_back(GraphicsAPI::WebGL);
 
+        if (IsGraphicsAPISupported(GraphicsAPI::Null))
+            availableAPIs.push_back(GraphicsAPI::Null);
+
         return availableAPIs;
     }
 
@@ -112,6 +115,10 @@ public:
         case GraphicsAPI::WebGL:
             return currentPlatform == Platform::WebGL;
 
+        // NOTE: The headless backend issues no GPU calls, so it runs everywhere
+        case GraphicsAPI::Null:
+            return true;
+
         default:
             return false;
         }
@@ -151,6 +158,8 @@ public:
             return "Metal";
         case GraphicsAPI::WebGL:
             return "WebGL";
+        case GraphicsAPI::Null:
+            return "Null";
         case GraphicsAPI::None:
             return "None";
         default:
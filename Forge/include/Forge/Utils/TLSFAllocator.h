@@ -0,0 +1,103 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef TLSFALLOCATOR_H
+#define TLSFALLOCATOR_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace forge {
+
+struct TLSFAllocation {
+    uint32_t offset{0};
+    uint32_t size{0};
+    uint32_t node{UINT32_MAX};
+
+    [[nodiscard]] bool IsValid() const noexcept {
+        return node != UINT32_MAX;
+    }
+};
+
+// NOTE: Two level segregated fit allocator over an abstract range [0, capacity). It only
+// hands out offsets, the memory itself lives elsewhere (e.g. a GPU buffer), so block headers
+// are kept in a side table instead of in the managed range. Allocate and Free are O(1),
+// free neighbours are merged immediately. Sizes and offsets are multiples of GRANULARITY.
+class TLSFAllocator {
+public:
+    static constexpr uint32_t GRANULARITY = 4;
+
+    explicit TLSFAllocator(uint32_t capacity = 0);
+
+    // NOTE: alignment does not have to be a power of two (vertex strides), it has to be a
+    // multiple of GRANULARITY. Returns an invalid allocation when no free block fits.
+    [[nodiscard]] TLSFAllocation Allocate(uint32_t size, uint32_t alignment = GRANULARITY);
+    // NOTE: Carves a specific range out of free space, used to rebuild the allocator after
+    // the caller moved its allocations around
+    [[nodiscard]] TLSFAllocation AllocateAt(uint32_t offset, uint32_t size);
+    void Free(const TLSFAllocation& allocation);
+
+    // Drops every allocation
+    void Reset();
+
+    [[nodiscard]] uint32_t GetCapacity() const noexcept {
+        return m_Capacity;
+    }
+    [[nodiscard]] uint32_t GetUsedSize() const noexcept {
+        return m_UsedSize;
+    }
+    [[nodiscard]] uint32_t GetFreeSize() const noexcept {
+        return m_Capacity - m_UsedSize;
+    }
+    [[nodiscard]] uint32_t GetLargestFreeBlock() const noexcept;
+
+    // NOTE: Share of the free space that is not part of the largest free block, 0 when all
+    // free space is contiguous
+    [[nodiscard]] float GetFragmentation() const noexcept;
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr uint32_t SL_COUNT_LOG2 = 4;
+    static constexpr uint32_t SL_COUNT = 1u << SL_COUNT_LOG2;
+    static constexpr uint32_t FL_SHIFT = SL_COUNT_LOG2 + 2;
+    static constexpr uint32_t SMALL_BLOCK_SIZE = 1u << FL_SHIFT;
+    static constexpr uint32_t FL_COUNT = 32 - FL_SHIFT + 1;
+
+    struct Block {
+        uint32_t offset{0};
+        uint32_t size{0};
+        uint32_t prevPhysical{NONE};
+        uint32_t nextPhysical{NONE};
+        uint32_t prevFree{NONE};
+        uint32_t nextFree{NONE};
+        bool free{false};
+    };
+
+    static void Mapping(uint32_t size, uint32_t& fl, uint32_t& sl) noexcept;
+
+    uint32_t FindFreeBlock(uint32_t size) const noexcept;
+    void InsertFree(uint32_t node);
+    void RemoveFree(uint32_t node);
+    // NOTE: Splits the block at offset + size, the tail becomes a new free block
+    void SplitTail(uint32_t node, uint32_t size);
+    // NOTE: Splits off the first size bytes of the block as a new free block
+    void SplitHead(uint32_t node, uint32_t size);
+    uint32_t Merge(uint32_t node);
+    uint32_t NewNode();
+    void ReleaseNode(uint32_t node);
+
+    std::vector<Block> m_Blocks;
+    std::vector<uint32_t> m_UnusedNodes;
+
+    uint32_t m_FirstLevelMap{0};
+    std::array<uint32_t, FL_COUNT> m_SecondLevelMap{};
+    std::array<std::array<uint32_t, SL_COUNT>, FL_COUNT> m_FreeLists{};
+
+    uint32_t m_Capacity{0};
+    uint32_t m_UsedSize{0};
+};
+
+} // namespace forge
+
+#endif
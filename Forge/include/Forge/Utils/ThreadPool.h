@@ -0,0 +1,65 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace forge {
+
+// NOTE: Fixed size pool of worker threads consuming a FIFO job queue.
+// Jobs must not block waiting on other jobs of the same pool.
+class ThreadPool {
+public:
+    explicit ThreadPool(uint32_t threadCount = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <typename F>
+    [[nodiscard]] std::future<std::invoke_result_t<F>> Submit(F&& job) {
+        using ResultType = std::invoke_result_t<F>;
+
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<F>(job));
+        std::future<ResultType> future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.emplace([task]() {
+                (*task)();
+            });
+        }
+        m_Condition.notify_one();
+        return future;
+    }
+
+    [[nodiscard]] uint32_t GetThreadCount() const noexcept {
+        return static_cast<uint32_t>(m_Workers.size());
+    }
+
+    // Engine wide pool shared by the subsystems that fan out work
+    static ThreadPool& Get();
+
+private:
+    void WorkerLoop();
+
+    std::vector<std::thread> m_Workers;
+    std::queue<std::function<void()>> m_Jobs;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_Stopping{false};
+};
+
+} // namespace forge
+
+#endif
@@ -2,67 +2,27 @@
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 
 #include "Forge/Events/Event.h"
+#include "Forge/Events/InputSnapshot.h"
 
 namespace forge {
 
-std::vector<bool> Keyboard::m_Keys(512, false);
-
 bool const Keyboard::IsKeyPressed(int key) {
-    if (key >= 0 && key < m_Keys.size()) {
-        return m_Keys[key];
-    }
-    return false;
-}
-
-void Keyboard::SetKey(int key, bool IsKeyPressed) {
-    if (key >= 0 && key < m_Keys.size()) {
-        m_Keys[key] = IsKeyPressed;
-    }
-}
-
-// Define the static member variables
-double Mouse::x = 1.0;
-double Mouse::y = 1.0;
-
-double Mouse::lastx = 1.0;
-double Mouse::lasty = 1.0;
-
-double Mouse::dx = 1.0;
-double Mouse::dy = 1.0;
-
-double Mouse::scrollDx = 1.0;
-double Mouse::scrollDy = 1.0;
-
-void Mouse::SetCursorPosition(double _x, double _y) {
-    x = _x;
-    y = _y;
-}
-
-void Mouse::SetWheelScroll(double dx, double dy) {
-    scrollDx = dx;
-    scrollDy = dy;
+    return InputState::Get().GetCurrent().IsKeyDown(key);
 }
 
 std::pair<double, double> const Mouse::GetMousePosition() {
-    return {x, y};
+    const InputSnapshot& snapshot = InputState::Get().GetCurrent();
+    return {snapshot.cursorX, snapshot.cursorY};
 }
 
 std::pair<double, double> const Mouse::GetMouseDeltaMovement() {
-    dx = x - lastx;
-    dy = y - lasty;
-    lastx = x;
-    lasty = y;
-    return {dx, dy};
+    const InputSnapshot& snapshot = InputState::Get().GetCurrent();
+    return {snapshot.deltaX, snapshot.deltaY};
 }
 
 std::pair<double, double> const Mouse::GetMouseDeltaScroll() {
-    double tempScrollDx = scrollDx;
-    double tempScrollDy = scrollDy;
-
-    scrollDx = 0.0;
-    scrollDy = 0.0;
-
-    return {tempScrollDx, tempScrollDy};
+    const InputSnapshot& snapshot = InputState::Get().GetCurrent();
+    return {snapshot.scrollX, snapshot.scrollY};
 }
 
 // Initialize static member variables
@@ -0,0 +1,137 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Events/EventDispatcher.h"
+#include "Forge/Utils/Common.h"
+
+#include <algorithm>
+
+namespace forge {
+
+SubscriptionID EventDispatcher::Subscribe(EventType type, Action action, EventHandlerFn handler, EventPriority priority) {
+    FORGE_ASSERT(handler, "Subscribing an empty event handler");
+    FORGE_ASSERT(static_cast<uint32_t>(type) < TYPE_COUNT && static_cast<uint32_t>(action) < ACTION_COUNT,
+                 "Event type or action out of range");
+
+    SubscriptionID id = m_NextID++;
+    uint32_t slot = GetSlot(type, action);
+    m_Slots.emplace(id, slot);
+
+    Subscriber subscriber{id, priority, std::move(handler)};
+    if (m_DispatchDepth > 0) {
+        m_PendingSubscribers.push_back(PendingSubscriber{slot, std::move(subscriber)});
+    } else {
+        Insert(slot, std::move(subscriber));
+    }
+    return id;
+}
+
+void EventDispatcher::Unsubscribe(SubscriptionID id) {
+    auto it = m_Slots.find(id);
+    if (it == m_Slots.end()) {
+        return;
+    }
+
+    std::vector<Subscriber>& table = m_Tables[it->second];
+    m_Slots.erase(it);
+
+    std::erase_if(m_PendingSubscribers, [id](const PendingSubscriber& pending) {
+        return pending.subscriber.id == id;
+    });
+
+    auto subscriber = std::find_if(table.begin(), table.end(), [id](const Subscriber& entry) {
+        return entry.id == id;
+    });
+    if (subscriber == table.end()) {
+        return;
+    }
+
+    // NOTE: The handler may be the one running, it is only marked and erased after dispatch
+    if (m_DispatchDepth > 0) {
+        subscriber->id = INVALID_SUBSCRIPTION;
+        m_HasRemovedSubscribers = true;
+    } else {
+        table.erase(subscriber);
+    }
+}
+
+bool EventDispatcher::Dispatch(const Event& event) {
+    EventType type = event.GetType();
+    Action action = event.GetAction();
+    FORGE_ASSERT(static_cast<uint32_t>(type) < TYPE_COUNT && static_cast<uint32_t>(action) < ACTION_COUNT,
+                 "Event type or action out of range");
+
+    // Exact pair, every action of the type, every event
+    std::array<const std::vector<Subscriber>*, 3> tables{};
+    uint32_t tableCount = 0;
+    tables[tableCount++] = &m_Tables[GetSlot(type, action)];
+    if (action != Action::None) {
+        tables[tableCount++] = &m_Tables[GetSlot(type, Action::None)];
+    }
+    if (type != EventType::None) {
+        tables[tableCount++] = &m_Tables[GetSlot(EventType::None, Action::None)];
+    }
+
+    m_DispatchDepth++;
+
+    // NOTE: Merge the sorted tables by priority and subscription order
+    std::array<size_t, 3> positions{};
+    bool consumed = false;
+    while (!consumed) {
+        const Subscriber* next = nullptr;
+        uint32_t nextTable = 0;
+        for (uint32_t i = 0; i < tableCount; i++) {
+            if (positions[i] == tables[i]->size()) {
+                continue;
+            }
+
+            const Subscriber& candidate = (*tables[i])[positions[i]];
+            if (!next || candidate.priority < next->priority ||
+                (candidate.priority == next->priority && candidate.id < next->id)) {
+                next = &candidate;
+                nextTable = i;
+            }
+        }
+        if (!next) {
+            break;
+        }
+
+        positions[nextTable]++;
+        if (next->id != INVALID_SUBSCRIPTION) {
+            consumed = next->handler(event);
+        }
+    }
+
+    if (--m_DispatchDepth == 0) {
+        ApplyPendingChanges();
+    }
+    return consumed;
+}
+
+void EventDispatcher::Insert(uint32_t slot, Subscriber subscriber) {
+    std::vector<Subscriber>& table = m_Tables[slot];
+    auto position = std::upper_bound(table.begin(), table.end(), subscriber.priority,
+                                     [](EventPriority priority, const Subscriber& entry) {
+                                         return priority < entry.priority;
+                                     });
+    table.insert(position, std::move(subscriber));
+}
+
+void EventDispatcher::ApplyPendingChanges() {
+    if (m_HasRemovedSubscribers) {
+        for (std::vector<Subscriber>& table : m_Tables) {
+            std::erase_if(table, [](const Subscriber& entry) {
+                return entry.id == INVALID_SUBSCRIPTION;
+            });
+        }
+        m_HasRemovedSubscribers = false;
+    }
+
+    std::vector<PendingSubscriber> pending = std::move(m_PendingSubscribers);
+    m_PendingSubscribers.clear();
+    for (PendingSubscriber& entry : pending) {
+        Insert(entry.slot, std::move(entry.subscriber));
+    }
+}
+
+} // namespace forge
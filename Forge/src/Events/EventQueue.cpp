@@ -0,0 +1,65 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Events/EventQueue.h"
+#include "Forge/Events/InputSnapshot.h"
+
+namespace forge {
+
+bool EventQueue::IsCoalescable(const EventRecord& record) noexcept {
+    switch (record.action) {
+    case Action::MouseMove:
+    case Action::Move:
+    case Action::Resize:
+    case Action::FramebufferResize:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void EventQueue::ApplyState(const EventRecord& record) noexcept {
+    switch (record.action) {
+    case Action::KeyPress:
+    case Action::MousePress:
+        if (record.type == EventType::Key) {
+            InputState::Get().OnKey(record.code, true);
+        }
+        break;
+    case Action::KeyRelease:
+    case Action::MouseRelease:
+        if (record.type == EventType::Key) {
+            InputState::Get().OnKey(record.code, false);
+        }
+        break;
+    case Action::MouseMove:
+        InputState::Get().OnCursor(record.x, record.y);
+        break;
+    case Action::MouseScroll:
+        InputState::Get().OnScroll(record.x, record.y);
+        break;
+    case Action::Move:
+        ApplicationStats::SetApplicationPosition(record.x, record.y);
+        break;
+    case Action::Resize:
+        ApplicationStats::SetApplicationSize(record.x, record.y);
+        break;
+    case Action::Maximize:
+        ApplicationStats::SetFullscreen(true);
+        break;
+    case Action::Restore:
+    case Action::Iconify:
+        ApplicationStats::SetFullscreen(false);
+        break;
+    case Action::Focus:
+        ApplicationStats::SetFocused(true);
+        break;
+    case Action::LoseFocus:
+        ApplicationStats::SetFocused(false);
+        break;
+    default:
+        break;
+    }
+}
+
+} // namespace forge
@@ -0,0 +1,81 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Events/EventRecording.h"
+#include "Forge/Utils/Log.h"
+
+namespace forge {
+
+bool EventRecorder::Open(const std::string& path, uint32_t width, uint32_t height) {
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File) {
+        Log::Error("Failed to open event recording '{}' for writing", path);
+        return false;
+    }
+
+    EventRecordingHeader header;
+    header.width = width;
+    header.height = height;
+    m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    m_Start = std::chrono::steady_clock::now();
+    m_RecordCount = 0;
+    Log::Info("Recording events to '{}'", path);
+    return true;
+}
+
+void EventRecorder::Record(uint64_t frame, const EventRecord& record) {
+    if (!m_File.is_open()) {
+        return;
+    }
+
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - m_Start;
+    EventRecordingEntry entry{frame, time.count(), record};
+    m_File.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    m_RecordCount++;
+}
+
+void EventRecorder::Close() {
+    if (!m_File.is_open()) {
+        return;
+    }
+
+    m_File.close();
+    Log::Info("Recorded {} events", m_RecordCount);
+}
+
+bool EventPlayer::Open(const std::string& path) {
+    m_File.open(path, std::ios::binary);
+    if (!m_File) {
+        Log::Error("Failed to open event recording '{}'", path);
+        return false;
+    }
+
+    m_File.read(reinterpret_cast<char*>(&m_Header), sizeof(m_Header));
+    if (!m_File || m_Header.magic != EventRecordingHeader::MAGIC) {
+        Log::Error("'{}' is not an event recording", path);
+        m_File.close();
+        return false;
+    }
+    if (m_Header.version != EventRecordingHeader::VERSION) {
+        Log::Error("Event recording '{}' has version {}, expected {}", path, m_Header.version, EventRecordingHeader::VERSION);
+        m_File.close();
+        return false;
+    }
+
+    m_PlayedCount = 0;
+    m_RecordedTime = 0.0;
+    ReadNext();
+    Log::Info("Replaying events from '{}' (recorded at {}x{})", path, m_Header.width, m_Header.height);
+    return true;
+}
+
+void EventPlayer::ReadNext() {
+    m_File.read(reinterpret_cast<char*>(&m_Next), sizeof(m_Next));
+    m_HasNext = static_cast<bool>(m_File);
+    if (m_HasNext) {
+        m_RecordedTime = m_Next.time;
+    }
+}
+
+} // namespace forge
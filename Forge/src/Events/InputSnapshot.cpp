@@ -0,0 +1,72 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Events/InputSnapshot.h"
+
+namespace forge {
+
+// NOTE: Depth rather than a flag, a handler may pump events again (e.g. a modal loop)
+static thread_local uint32_t t_DispatchDepth = 0;
+
+InputState& InputState::Get() {
+    static InputState s_State;
+    return s_State;
+}
+
+const InputSnapshot& InputState::GetCurrent() const noexcept {
+    return t_DispatchDepth > 0 ? m_Pending : GetSnapshot();
+}
+
+InputState::DispatchScope::DispatchScope() noexcept {
+    t_DispatchDepth++;
+}
+
+InputState::DispatchScope::~DispatchScope() {
+    t_DispatchDepth--;
+}
+
+void InputState::OnKey(int key, bool down) noexcept {
+    if (!InputSnapshot::IsValidKey(key) || m_Pending.down.test(key) == down) {
+        return;
+    }
+
+    m_Pending.down.set(key, down);
+    // NOTE: A key pressed and released within one frame reports both edges
+    if (down) {
+        m_Pending.pressed.set(key);
+    } else {
+        m_Pending.released.set(key);
+    }
+}
+
+void InputState::OnCursor(double x, double y) noexcept {
+    // The first position has nothing to be a delta from
+    if (m_HasCursor) {
+        m_Pending.deltaX += x - m_Pending.cursorX;
+        m_Pending.deltaY += y - m_Pending.cursorY;
+    }
+    m_HasCursor = true;
+    m_Pending.cursorX = x;
+    m_Pending.cursorY = y;
+}
+
+void InputState::OnScroll(double x, double y) noexcept {
+    m_Pending.scrollX += x;
+    m_Pending.scrollY += y;
+}
+
+void InputState::Publish() noexcept {
+    uint32_t slot = (m_Published.load(std::memory_order_relaxed) + 1) % m_Snapshots.size();
+    m_Snapshots[slot] = m_Pending;
+    m_Published.store(slot, std::memory_order_release);
+
+    m_Pending.pressed.reset();
+    m_Pending.released.reset();
+    m_Pending.deltaX = 0.0;
+    m_Pending.deltaY = 0.0;
+    m_Pending.scrollX = 0.0;
+    m_Pending.scrollY = 0.0;
+    m_Pending.frame++;
+}
+
+} // namespace forge
@@ -6,8 +6,9 @@
 namespace forge {
 
 // NOTE: BufferLayout
-BufferLayout::BufferLayout(std::initializer_list<BufferElement> elements)
-    : m_Elements(elements) {
+BufferLayout::BufferLayout(std::initializer_list<BufferElement> elements, uint32_t divisor)
+    : m_Elements(elements)
+    , m_Divisor(divisor) {
     CalculateOffsetsAndStride();
 }
 
@@ -15,6 +16,14 @@ uint32_t BufferLayout::GetStride() const {
     return m_Stride;
 }
 
+uint32_t BufferLayout::GetDivisor() const {
+    return m_Divisor;
+}
+
+bool BufferLayout::IsInstanced() const {
+    return m_Divisor != 0;
+}
+
 const std::vector<BufferElement>& BufferLayout::GetElements() const {
     return m_Elements;
 }
@@ -45,4 +54,29 @@ void BufferLayout::CalculateOffsetsAndStride() {
     }
 }
 
+BufferData::BufferData(BufferData&& other) noexcept
+    : m_Storage(std::move(other.m_Storage))
+    , m_Data(other.m_Data)
+    , m_Size(other.m_Size) {
+    other.m_Data = nullptr;
+    other.m_Size = 0;
+}
+
+BufferData& BufferData::operator=(BufferData&& other) noexcept {
+    if (this != &other) {
+        m_Storage = std::move(other.m_Storage);
+        m_Data = other.m_Data;
+        m_Size = other.m_Size;
+        other.m_Data = nullptr;
+        other.m_Size = 0;
+    }
+    return *this;
+}
+
+void BufferData::Release() noexcept {
+    m_Storage.reset();
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
 } // namespace forge
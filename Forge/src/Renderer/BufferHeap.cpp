@@ -0,0 +1,259 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/BufferHeap.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace forge {
+
+BufferHeap::BufferHeap(BufferHeapUsage usage, uint32_t pageSize, uint32_t vertexStride)
+    : m_Usage(usage) {
+    if (vertexStride) {
+        m_PageGranularity = std::lcm(vertexStride, TLSFAllocator::GRANULARITY);
+    }
+    m_PageSize = (pageSize + m_PageGranularity - 1) / m_PageGranularity * m_PageGranularity;
+    FORGE_ASSERT(m_PageSize > 0, "BufferHeap page size must not be zero");
+}
+
+uint32_t BufferHeap::CreatePage(uint32_t size) {
+    Page page;
+    page.allocator = TLSFAllocator(size);
+
+    // NOTE: Dynamic, writes are plain glBufferSubData calls instead of going through the render
+    // thread's staging ring, so a resource loader job can fill a resolved range too
+    switch (m_Usage) {
+    case BufferHeapUsage::Vertex:
+        page.vertexBuffer = VertexBuffer::Create(nullptr, size, BufferDrawMode::Dynamic);
+        break;
+    case BufferHeapUsage::Index:
+        page.indexBuffer = IndexBuffer::Create(nullptr, size / static_cast<uint32_t>(sizeof(uint32_t)), BufferDrawMode::Dynamic);
+        break;
+    }
+
+    m_Pages.push_back(std::move(page));
+    Log::Trace("BufferHeap: created page {} ({} bytes)", m_Pages.size() - 1, size);
+    return static_cast<uint32_t>(m_Pages.size() - 1);
+}
+
+Buffer* BufferHeap::GetPageBuffer(const Page& page) const {
+    if (m_Usage == BufferHeapUsage::Vertex) {
+        return page.vertexBuffer.get();
+    }
+    return page.indexBuffer.get();
+}
+
+void BufferHeap::WritePage(Page& page, const void* data, uint32_t size, uint32_t offset) {
+    if (m_Usage == BufferHeapUsage::Vertex) {
+        page.vertexBuffer->SubmitData(data, size, offset);
+    } else {
+        page.indexBuffer->SubmitData(data, size, offset);
+    }
+}
+
+void BufferHeap::MoveWithinPage(Page& page, uint32_t sourceOffset, uint32_t offset, uint32_t size) {
+    // NOTE: Data only moves towards the start of the page. When the ranges overlap the copy is
+    // split into chunks no larger than the distance, front to back, so no chunk overlaps itself
+    // and every chunk is read before a later one overwrites it.
+    FORGE_ASSERT(offset < sourceOffset, "BufferHeap only moves allocations down");
+
+    uint32_t distance = sourceOffset - offset;
+    for (uint32_t copied = 0; copied < size; copied += distance) {
+        uint32_t chunk = std::min(distance, size - copied);
+        if (m_Usage == BufferHeapUsage::Vertex) {
+            page.vertexBuffer->CopyData(sourceOffset + copied, offset + copied, chunk);
+        } else {
+            page.indexBuffer->CopyData(sourceOffset + copied, offset + copied, chunk);
+        }
+    }
+}
+
+BufferHeapHandle BufferHeap::Allocate(const void* data, uint32_t size, uint32_t alignment) {
+    PROFILE_FUNCTION();
+
+    TLSFAllocation allocation;
+    uint32_t pageIndex = 0;
+    for (; pageIndex < m_Pages.size(); pageIndex++) {
+        allocation = m_Pages[pageIndex].allocator.Allocate(size, alignment);
+        if (allocation.IsValid()) {
+            break;
+        }
+    }
+
+    if (!allocation.IsValid() && m_PageLimit && m_Pages.size() >= m_PageLimit) {
+        Log::Error("BufferHeap: {} bytes do not fit the heap's {} page(s)", size, m_Pages.size());
+        return {};
+    }
+
+    if (!allocation.IsValid()) {
+        uint32_t dedicatedSize = size + alignment;
+        dedicatedSize = (dedicatedSize + m_PageGranularity - 1) / m_PageGranularity * m_PageGranularity;
+        pageIndex = CreatePage(std::max(m_PageSize, dedicatedSize));
+        allocation = m_Pages[pageIndex].allocator.Allocate(size, alignment);
+        if (!allocation.IsValid()) {
+            Log::Error("BufferHeap: failed to allocate {} bytes", size);
+            return {};
+        }
+    }
+
+    Page& page = m_Pages[pageIndex];
+    page.allocationCount++;
+    if (data) {
+        WritePage(page, data, size, allocation.offset);
+    }
+
+    uint32_t index = 0;
+    if (!m_FreeEntries.empty()) {
+        index = m_FreeEntries.back();
+        m_FreeEntries.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_Entries.size());
+        m_Entries.emplace_back();
+    }
+
+    Entry& entry = m_Entries[index];
+    entry.allocation = allocation;
+    entry.page = pageIndex;
+    entry.alignment = alignment;
+    entry.live = true;
+
+    return BufferHeapHandle{index, entry.generation};
+}
+
+const BufferHeap::Entry* BufferHeap::FindEntry(BufferHeapHandle handle) const {
+    if (handle.index >= m_Entries.size()) {
+        return nullptr;
+    }
+
+    const Entry& entry = m_Entries[handle.index];
+    if (!entry.live || entry.generation != handle.generation) {
+        return nullptr;
+    }
+    return &entry;
+}
+
+void BufferHeap::Update(BufferHeapHandle handle, const void* data, uint32_t size, uint32_t offset) {
+    const Entry* entry = FindEntry(handle);
+    if (!entry) {
+        Log::Error("BufferHeap: update through a stale handle");
+        return;
+    }
+
+    FORGE_ASSERT(offset + size <= entry->allocation.size, "BufferHeap update out of range");
+    WritePage(m_Pages[entry->page], data, size, entry->allocation.offset + offset);
+}
+
+void BufferHeap::Free(BufferHeapHandle handle) {
+    if (!FindEntry(handle)) {
+        Log::Error("BufferHeap: freeing a stale handle");
+        return;
+    }
+
+    Entry& entry = m_Entries[handle.index];
+    Page& page = m_Pages[entry.page];
+    page.allocator.Free(entry.allocation);
+    page.allocationCount--;
+
+    entry.live = false;
+    entry.generation++;
+    m_FreeEntries.push_back(handle.index);
+}
+
+BufferHeapRange BufferHeap::Resolve(BufferHeapHandle handle) const {
+    const Entry* entry = FindEntry(handle);
+    if (!entry) {
+        return {};
+    }
+
+    return BufferHeapRange{GetPageBuffer(m_Pages[entry->page]), entry->page, entry->allocation.offset, entry->allocation.size};
+}
+
+uint64_t BufferHeap::Defragment(float threshold) {
+    PROFILE_FUNCTION();
+
+    uint64_t moved = 0;
+    for (uint32_t page = 0; page < m_Pages.size(); page++) {
+        if (m_Pages[page].allocator.GetFragmentation() > threshold) {
+            moved += CompactPage(page);
+        }
+    }
+
+    if (moved) {
+        m_LayoutVersion++;
+        Log::Trace("BufferHeap: defragmented, {} bytes moved", moved);
+    }
+    return moved;
+}
+
+uint64_t BufferHeap::CompactPage(uint32_t pageIndex) {
+    Page& page = m_Pages[pageIndex];
+
+    std::vector<uint32_t> entries;
+    entries.reserve(page.allocationCount);
+    for (uint32_t i = 0; i < m_Entries.size(); i++) {
+        if (m_Entries[i].live && m_Entries[i].page == pageIndex) {
+            entries.push_back(i);
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [this](uint32_t a, uint32_t b) {
+        return m_Entries[a].allocation.offset < m_Entries[b].allocation.offset;
+    });
+
+    // NOTE: Packing in offset order never moves an allocation up, the previous ones already
+    // fit below its old offset, so it is safe to copy in place in that order
+    uint64_t moved = 0;
+    uint32_t cursor = 0;
+    for (uint32_t index : entries) {
+        Entry& entry = m_Entries[index];
+        uint32_t offset = (cursor + entry.alignment - 1) / entry.alignment * entry.alignment;
+        if (offset != entry.allocation.offset) {
+            MoveWithinPage(page, entry.allocation.offset, offset, entry.allocation.size);
+            moved += entry.allocation.size;
+        }
+        entry.allocation.offset = offset;
+        cursor = offset + entry.allocation.size;
+    }
+
+    page.allocator.Reset();
+    for (uint32_t index : entries) {
+        Entry& entry = m_Entries[index];
+        entry.allocation = page.allocator.AllocateAt(entry.allocation.offset, entry.allocation.size);
+        FORGE_ASSERT(entry.allocation.IsValid(), "BufferHeap: compacted layout does not fit the page");
+    }
+
+    return moved;
+}
+
+const Shared<VertexBuffer>& BufferHeap::GetVertexBuffer(uint32_t page) const {
+    FORGE_ASSERT(m_Usage == BufferHeapUsage::Vertex && page < m_Pages.size(), "Not a vertex page of this heap");
+    return m_Pages[page].vertexBuffer;
+}
+
+const Shared<IndexBuffer>& BufferHeap::GetIndexBuffer(uint32_t page) const {
+    FORGE_ASSERT(m_Usage == BufferHeapUsage::Index && page < m_Pages.size(), "Not an index page of this heap");
+    return m_Pages[page].indexBuffer;
+}
+
+BufferHeapStats BufferHeap::GetStats() const {
+    BufferHeapStats stats;
+    stats.pageCount = GetPageCount();
+
+    uint64_t freeSize = 0;
+    for (const Page& page : m_Pages) {
+        stats.allocationCount += page.allocationCount;
+        stats.capacity += page.allocator.GetCapacity();
+        stats.usedSize += page.allocator.GetUsedSize();
+        stats.largestFreeBlock = std::max(stats.largestFreeBlock, page.allocator.GetLargestFreeBlock());
+        freeSize += page.allocator.GetFreeSize();
+    }
+
+    if (freeSize) {
+        stats.fragmentation = 1.0f - static_cast<float>(stats.largestFreeBlock) / static_cast<float>(freeSize);
+    }
+    return stats;
+}
+
+} // namespace forge
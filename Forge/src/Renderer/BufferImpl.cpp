@@ -4,18 +4,23 @@
 #include "Forge/Renderer/BufferImpl.h"
 #include "Forge/Utils/Log.h"
 #include "Forge/Utils/Platform.h"
+#include "Null/NullBuffer.h"
 #include "OpenGL/OpenGLBuffer.h"
 
+#include <cstring>
+
 namespace forge {
 
-Shared<VertexBuffer> VertexBuffer::Create(const void* data, uint32_t count, BufferDrawMode mode) {
+Shared<VertexBuffer> VertexBuffer::Create(const void* data, uint32_t size, BufferDrawMode mode) {
 
-    auto api = PlatformAPI::GetDefaultGraphicsAPI();
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
 
     try {
         switch (api) {
         case GraphicsAPI::OpenGL:
-            return std::make_shared<OpenGLVertexBuffer>(data, count, mode);
+            return std::make_shared<OpenGLVertexBuffer>(data, size, mode);
+        case GraphicsAPI::Null:
+            return std::make_shared<NullVertexBuffer>(data, size, mode);
         case GraphicsAPI::Vulkan:
         case GraphicsAPI::DirectX12:
         case GraphicsAPI::Metal:
@@ -34,14 +39,25 @@ Shared<VertexBuffer> VertexBuffer::Create(const void* data, uint32_t count, Buff
     return nullptr;
 }
 
-Shared<IndexBuffer> IndexBuffer::Create(uint32_t* data, uint32_t count, BufferDrawMode mode) {
+bool VertexBuffer::ValidateLayout(const BufferLayout& layout, uint32_t size) {
+    uint32_t stride = layout.GetStride();
+    if (stride == 0 || size % stride != 0) {
+        Log::Error("Vertex buffer of {} bytes does not hold a whole number of {} byte vertices", size, stride);
+        return false;
+    }
+    return true;
+}
 
-    auto api = PlatformAPI::GetDefaultGraphicsAPI();
+Shared<IndexBuffer> IndexBuffer::Create(const uint32_t* data, uint32_t count, BufferDrawMode mode) {
+
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
 
     try {
         switch (api) {
         case GraphicsAPI::OpenGL:
             return std::make_shared<OpenGLIndexBuffer>(data, count, mode);
+        case GraphicsAPI::Null:
+            return std::make_shared<NullIndexBuffer>(data, count, mode);
         case GraphicsAPI::Vulkan:
         case GraphicsAPI::DirectX12:
         case GraphicsAPI::Metal:
@@ -60,13 +76,19 @@ Shared<IndexBuffer> IndexBuffer::Create(uint32_t* data, uint32_t count, BufferDr
     return nullptr;
 }
 
+Shared<IndexBuffer> IndexBuffer::Create(std::span<const uint32_t> indices, BufferDrawMode mode) {
+    return Create(indices.data(), static_cast<uint32_t>(indices.size()), mode);
+}
+
 Shared<VertexArrayBuffer> VertexArrayBuffer::Create() {
-    auto api = PlatformAPI::GetDefaultGraphicsAPI();
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
 
     try {
         switch (api) {
         case GraphicsAPI::OpenGL:
             return std::make_shared<OpenGLVertexArrayBuffer>();
+        case GraphicsAPI::Null:
+            return std::make_shared<NullVertexArrayBuffer>();
         case GraphicsAPI::Vulkan:
         case GraphicsAPI::DirectX12:
         case GraphicsAPI::Metal:
@@ -85,4 +107,93 @@ Shared<VertexArrayBuffer> VertexArrayBuffer::Create() {
     return nullptr;
 }
 
+UniformAllocation UniformBuffer::Upload(const void* data, uint32_t size) {
+    UniformAllocation allocation = Allocate(size);
+    if (allocation.IsValid()) {
+        std::memcpy(allocation.data, data, size);
+    }
+    return allocation;
+}
+
+Shared<UniformBuffer> UniformBuffer::Create(uint32_t frameCapacity) {
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
+
+    try {
+        switch (api) {
+        case GraphicsAPI::OpenGL:
+            return std::make_shared<OpenGLUniformBuffer>(frameCapacity);
+        case GraphicsAPI::Null:
+            return std::make_shared<NullUniformBuffer>(frameCapacity);
+        case GraphicsAPI::Vulkan:
+        case GraphicsAPI::DirectX12:
+        case GraphicsAPI::Metal:
+            Log::Error("UniformBuffer: {} not implemented", PlatformAPI::GetGraphicsAPIName(api));
+            FORGE_ASSERT(false, "Graphics API not implemented for UniformBuffer");
+            break;
+        default:
+            Log::Error("Unknown graphics API");
+            FORGE_ASSERT(false, "Unknown graphics API");
+        }
+    } catch (const std::exception& e) {
+        Log::Error("Failed to create uniform buffer: {}", e.what());
+        FORGE_ASSERT(false, e.what());
+    }
+
+    return nullptr;
+}
+
+Shared<StorageBuffer> StorageBuffer::Create(const void* data, uint32_t size, BufferDrawMode mode) {
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
+
+    try {
+        switch (api) {
+        case GraphicsAPI::OpenGL:
+            return std::make_shared<OpenGLStorageBuffer>(data, size, mode);
+        case GraphicsAPI::Null:
+            return std::make_shared<NullStorageBuffer>(data, size, mode);
+        case GraphicsAPI::Vulkan:
+        case GraphicsAPI::DirectX12:
+        case GraphicsAPI::Metal:
+            Log::Error("StorageBuffer: {} not implemented", PlatformAPI::GetGraphicsAPIName(api));
+            FORGE_ASSERT(false, "Graphics API not implemented for StorageBuffer");
+            break;
+        default:
+            Log::Error("Unknown graphics API");
+            FORGE_ASSERT(false, "Unknown graphics API");
+        }
+    } catch (const std::exception& e) {
+        Log::Error("Failed to create storage buffer: {}", e.what());
+        FORGE_ASSERT(false, e.what());
+    }
+
+    return nullptr;
+}
+
+Shared<IndirectBuffer> IndirectBuffer::Create(uint32_t capacity) {
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
+
+    try {
+        switch (api) {
+        case GraphicsAPI::OpenGL:
+            return std::make_shared<OpenGLIndirectBuffer>(capacity);
+        case GraphicsAPI::Null:
+            return std::make_shared<NullIndirectBuffer>(capacity);
+        case GraphicsAPI::Vulkan:
+        case GraphicsAPI::DirectX12:
+        case GraphicsAPI::Metal:
+            Log::Error("IndirectBuffer: {} not implemented", PlatformAPI::GetGraphicsAPIName(api));
+            FORGE_ASSERT(false, "Graphics API not implemented for IndirectBuffer");
+            break;
+        default:
+            Log::Error("Unknown graphics API");
+            FORGE_ASSERT(false, "Unknown graphics API");
+        }
+    } catch (const std::exception& e) {
+        Log::Error("Failed to create indirect buffer: {}", e.what());
+        FORGE_ASSERT(false, e.what());
+    }
+
+    return nullptr;
+}
+
 } // namespace forge
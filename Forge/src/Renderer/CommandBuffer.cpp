@@ -0,0 +1,67 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/CommandBuffer.h"
+#include "Forge/Renderer/RenderAPI.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <future>
+
+namespace forge {
+
+CommandBuffer::CommandBuffer(size_t arenaSize)
+    : m_InitialBlock(arenaSize)
+    , m_Arena(m_InitialBlock.data(), m_InitialBlock.size())
+    , m_Commands(&m_Arena) {
+    m_Commands.reserve(arenaSize / sizeof(DrawCommand) / 2);
+}
+
+void CommandBuffer::Record(const DrawCommand& command) {
+    m_Commands.push_back(command);
+}
+
+void CommandBuffer::Reset() {
+    size_t previousCount = m_Commands.size();
+
+    // NOTE: The vector has to let go of its storage before the arena is rewound
+    {
+        std::pmr::vector<DrawCommand> empty(&m_Arena);
+        m_Commands.swap(empty);
+    }
+    m_Arena.release();
+
+    // Size for what the last frame needed so steady state recording does not regrow
+    m_Commands.reserve(previousCount);
+}
+
+CommandBufferSet::CommandBufferSet(uint32_t partitionCount, ThreadPool& pool)
+    : m_Pool(pool) {
+    m_CommandBuffers.reserve(partitionCount);
+    for (uint32_t i = 0; i < partitionCount; i++) {
+        m_CommandBuffers.push_back(std::make_unique<CommandBuffer>());
+    }
+}
+
+void CommandBufferSet::Record(const RecordFunction& record) {
+    PROFILE_FUNCTION();
+
+    std::vector<std::future<void>> jobs;
+    jobs.reserve(m_CommandBuffers.size());
+    for (uint32_t i = 0; i < m_CommandBuffers.size(); i++) {
+        CommandBuffer& commandBuffer = *m_CommandBuffers[i];
+        commandBuffer.Reset();
+        jobs.push_back(m_Pool.Submit([&record, &commandBuffer, i]() { record(i, commandBuffer); }));
+    }
+
+    for (auto& job : jobs) {
+        job.get();
+    }
+}
+
+void CommandBufferSet::SubmitTo(RenderAPI& renderAPI) {
+    for (const auto& commandBuffer : m_CommandBuffers) {
+        renderAPI.Submit(*commandBuffer);
+    }
+}
+
+} // namespace forge
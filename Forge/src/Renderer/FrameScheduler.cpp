@@ -0,0 +1,113 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/FrameScheduler.h"
+#include "Forge/Events/InputSnapshot.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace forge {
+
+FrameScheduler::FrameScheduler(Shared<Window> window, const FrameSchedulerDescriptor& descriptor)
+    : m_Window(window)
+    , m_Descriptor(descriptor) {
+    FORGE_ASSERT(window, "Window handle is null!");
+    m_Window->EnableVSync(descriptor.vsync);
+}
+
+void FrameScheduler::RequestRedraw(uint32_t frames) noexcept {
+    m_PendingRedraws = std::max(m_PendingRedraws, frames);
+}
+
+void FrameScheduler::BeginAnimation() noexcept {
+    m_Animations++;
+}
+
+void FrameScheduler::EndAnimation() noexcept {
+    FORGE_ASSERT(m_Animations > 0, "EndAnimation called without BeginAnimation");
+    m_Animations--;
+}
+
+bool FrameScheduler::IsIdle() const noexcept {
+    return !m_Descriptor.continuous && m_Animations == 0 && m_PendingRedraws == 0;
+}
+
+bool FrameScheduler::BeginFrame() {
+    if (IsIdle()) {
+        PROFILE_SCOPE("FrameScheduler::Idle");
+        m_Window->WaitEvents(m_Descriptor.idleTimeout);
+        m_IdleWaits++;
+
+        // NOTE: Events handled during the wait are what requests a redraw
+        if (IsIdle()) {
+            return false;
+        }
+    } else {
+        m_Window->Update();
+    }
+
+    m_FrameStart = Clock::now();
+    if (m_Frames > 0) {
+        std::chrono::duration<double> delta = m_FrameStart - m_LastFrameStart;
+        m_DeltaTime = std::min(delta.count(), MAX_DELTA_TIME);
+    }
+    m_LastFrameStart = m_FrameStart;
+    if (m_Descriptor.fixedDeltaTime > 0.0) {
+        m_DeltaTime = m_Descriptor.fixedDeltaTime;
+    }
+
+    if (m_PendingRedraws > 0) {
+        m_PendingRedraws--;
+    }
+
+    // NOTE: Input seen while idle is folded into the snapshot of the next drawn frame
+    InputState::Get().Publish();
+    return true;
+}
+
+void FrameScheduler::EndFrame() {
+    Clock::time_point end = Clock::now();
+    std::chrono::duration<double, std::milli> frameTime = end - m_FrameStart;
+    m_FrameTimes[m_Frames % STATS_WINDOW] = static_cast<float>(frameTime.count());
+    m_Frames++;
+
+    if (m_Descriptor.maxFrameRate > 0.0) {
+        auto budget = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_Descriptor.maxFrameRate));
+        Clock::time_point target = m_FrameStart + budget;
+        if (end < target) {
+            PROFILE_SCOPE("FrameScheduler::Cap");
+            std::this_thread::sleep_until(target);
+        }
+    }
+}
+
+FrameStats FrameScheduler::GetStats() const {
+    FrameStats stats;
+    stats.frames = m_Frames;
+    stats.idleWaits = m_IdleWaits;
+    if (m_Frames == 0) {
+        return stats;
+    }
+
+    uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(m_Frames, STATS_WINDOW));
+    std::array<float, STATS_WINDOW> sorted;
+    std::copy_n(m_FrameTimes.begin(), count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + count);
+
+    double total = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        total += sorted[i];
+    }
+
+    stats.lastFrameTime = m_FrameTimes[(m_Frames - 1) % STATS_WINDOW];
+    stats.averageFrameTime = total / count;
+    stats.minFrameTime = sorted[0];
+    stats.maxFrameTime = sorted[count - 1];
+    stats.p99FrameTime = sorted[std::min(count - 1, count * 99 / 100)];
+    return stats;
+}
+
+} // namespace forge
@@ -1,12 +1,22 @@
 // Copyright (c) 2025-present, Rusu Alexei & Project contributors.
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 #include "Forge/Renderer/GraphicsContext.h"
+#include "Forge/Renderer/RenderAPI.h"
+#include "Forge/Renderer/Shader/AsyncShader.h"
 #include "Forge/Utils/Log.h"
 #include "Forge/Utils/Platform.h"
+#include "Null/NullContext.h"
 #include "OpenGL/OpenGLContext.h"
 
 namespace forge {
 
+GraphicsContext::~GraphicsContext() {
+    // NOTE: The backend destructor has already run, the native context itself is owned by
+    // the window and still alive here
+    AsyncShader::DestroyFallbackShader();
+    RenderAPI::Shutdown();
+}
+
 Unique<GraphicsContext> GraphicsContext::Create(Shared<Window> window) {
     if (!window) {
         Log::Critical("Null window handle passed to GraphicsContext::Create");
@@ -21,6 +31,10 @@ Unique<GraphicsContext> GraphicsContext::Create(Shared<Window> window) {
         context = CreateUnique<OpenGLContext>(window);
         break;
 
+    case GraphicsAPI::Null:
+        context = CreateUnique<NullContext>(window);
+        break;
+
     case GraphicsAPI::Vulkan:
 #ifdef RESHAPE_VULKAN_SUPPORT
         // context = CreateUnique<VulkanContext>(window);
@@ -73,6 +87,8 @@ Unique<GraphicsContext> GraphicsContext::Create(Shared<Window> window) {
         return nullptr;
     }
 
+    AsyncShader::CreateFallbackShader();
+
     return context;
 }
 
@@ -0,0 +1,232 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/Material.h"
+#include "Forge/Renderer/RenderAPI.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace forge {
+
+// NOTE: The first upload of a frame rewrites each block in place, the extra room covers
+// blocks that change again between draws of the same frame. It is only the starting size,
+// the ring grows when a frame needs more.
+static constexpr uint32_t MATERIAL_UPLOADS_PER_FRAME = 4;
+static constexpr uint32_t MATERIAL_BLOCK_ALIGNMENT = 256;
+
+Material::Material(Shared<Shader> shader)
+    : m_Shader(std::move(shader)) {
+    FORGE_ASSERT(m_Shader, "Material requires a shader");
+
+    static std::atomic<uint16_t> s_NextSortID{0};
+    m_SortID = s_NextSortID.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool Material::SetData(ShaderResourceKey name, const void* data, uint32_t size) {
+    auto& value = m_Values[name.hash];
+    value.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+
+    if (!m_LayoutBuilt) {
+        return true;
+    }
+
+    auto it = m_Members.find(name.hash);
+    if (it == m_Members.end()) {
+        return false;
+    }
+
+    WriteMember(it->second, data, size);
+    return true;
+}
+
+void Material::Bind() {
+    PROFILE_FUNCTION();
+
+    m_Shader->Bind();
+    PrepareBlocks();
+
+    for (const auto& block : m_Blocks) {
+        if (block.allocation.IsValid()) {
+            block.buffer->BindRange(block.binding, block.allocation);
+        }
+    }
+}
+
+void Material::Prepare(DrawCommand& command) {
+    PROFILE_FUNCTION();
+
+    command.shader = m_Shader.get();
+    PrepareBlocks();
+
+    for (const auto& block : m_Blocks) {
+        if (block.allocation.IsValid()) {
+            command.AddUniform(block.buffer, block.allocation, block.binding);
+        }
+    }
+}
+
+void Material::PrepareBlocks() {
+    // Build once, then again when an async shader swaps the fallback for the real program
+    if (!m_LayoutBuilt || (!m_LayoutFinal && m_Shader->IsReady())) {
+        BuildLayout();
+    }
+
+    UploadBlocks();
+}
+
+void Material::BuildLayout() {
+    m_LayoutBuilt = true;
+    m_LayoutFinal = m_Shader->IsReady();
+    m_Blocks.clear();
+    m_Members.clear();
+    m_UploadFrame = UINT64_MAX;
+
+    uint32_t frameCapacity = 0;
+    for (const auto& resource : m_Shader->GetUniformBuffers()) {
+        // NOTE: Blocks shared by several stages are reflected once per stage
+        bool duplicate = false;
+        for (const auto& block : m_Blocks) {
+            duplicate |= block.binding == resource.binding;
+        }
+        if (duplicate || resource.size == 0) {
+            continue;
+        }
+
+        uint32_t blockIndex = static_cast<uint32_t>(m_Blocks.size());
+        UniformBlock& block = m_Blocks.emplace_back();
+        block.binding = resource.binding;
+        block.size = resource.size;
+        block.shadow.assign(resource.size, 0);
+        for (auto& range : block.dirty) {
+            range.Add(0, resource.size);
+        }
+
+        for (const auto& member : resource.members) {
+            m_Members.emplace(HashString(member.name), MemberRef{blockIndex, member.offset, member.size, member.matrixStride});
+        }
+
+        frameCapacity += (resource.size + MATERIAL_BLOCK_ALIGNMENT - 1) / MATERIAL_BLOCK_ALIGNMENT * MATERIAL_BLOCK_ALIGNMENT;
+    }
+
+    if (m_UniformBuffer) {
+        RetireUniformBuffer();
+    }
+    m_UniformBuffer = frameCapacity ? UniformBuffer::Create(frameCapacity * MATERIAL_UPLOADS_PER_FRAME) : nullptr;
+
+    for (const auto& [key, value] : m_Values) {
+        auto it = m_Members.find(key);
+        if (it != m_Members.end()) {
+            WriteMember(it->second, value.data(), static_cast<uint32_t>(value.size()));
+        }
+    }
+}
+
+void Material::WriteMember(const MemberRef& member, const void* data, uint32_t size) {
+    UniformBlock& block = m_Blocks[member.block];
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint8_t* destination = block.shadow.data() + member.offset;
+
+    if (size > member.size) {
+        Log::Warn("Material value of {} bytes truncated to its {} byte member", size, member.size);
+        size = member.size;
+    }
+
+    if (member.matrixStride && size < member.size) {
+        // Tightly packed columns into std140 columns
+        uint32_t columns = member.size / member.matrixStride;
+        uint32_t columnSize = size / columns;
+        for (uint32_t column = 0; column < columns; column++) {
+            std::memcpy(destination + column * member.matrixStride, bytes + column * columnSize, columnSize);
+        }
+    } else {
+        std::memcpy(destination, bytes, size);
+    }
+
+    for (auto& range : block.dirty) {
+        range.Add(member.offset, member.offset + member.size);
+    }
+    block.changedSinceUpload = true;
+}
+
+void Material::UploadBlocks() {
+    if (!m_UniformBuffer) {
+        return;
+    }
+
+    uint64_t frameIndex = RenderAPI::GetFrameIndex();
+    uint32_t frameSlot = RenderAPI::GetFrameSlot();
+    bool firstUploadThisFrame = frameIndex != m_UploadFrame;
+    m_UploadFrame = frameIndex;
+
+    if (firstUploadThisFrame) {
+        ReleaseRetiredBuffers(frameIndex);
+    }
+
+    for (auto& block : m_Blocks) {
+        if (firstUploadThisFrame) {
+            // NOTE: The ring hands out the same offsets every frame, so this region still holds
+            // what was written MAX_FRAMES_IN_FLIGHT frames ago and only the dirty range is copied
+            block.allocation = AllocateBlock(block.size);
+            block.buffer = m_UniformBuffer.get();
+            DirtyRange& range = block.dirty[frameSlot];
+            if (block.allocation.IsValid() && !range.IsEmpty()) {
+                std::memcpy(static_cast<uint8_t*>(block.allocation.data) + range.begin, block.shadow.data() + range.begin,
+                            range.end - range.begin);
+            }
+            range.Clear();
+        } else if (block.changedSinceUpload) {
+            // Earlier draws of this frame still read the previous copy. The slot keeps its dirty
+            // range so the in-place region catches up the next time this slot comes around.
+            block.allocation = AllocateBlock(block.size);
+            block.buffer = m_UniformBuffer.get();
+            if (block.allocation.IsValid()) {
+                std::memcpy(block.allocation.data, block.shadow.data(), block.size);
+            }
+        }
+
+        block.changedSinceUpload = false;
+    }
+}
+
+UniformAllocation Material::AllocateBlock(uint32_t size) {
+    UniformAllocation allocation = m_UniformBuffer->Allocate(size);
+    if (allocation.IsValid()) {
+        return allocation;
+    }
+
+    // NOTE: More changes this frame than the ring was sized for. Doubling keeps the number of
+    // regrows logarithmic in the peak demand, and the next frames fit without regrowing.
+    uint32_t alignedSize = (size + MATERIAL_BLOCK_ALIGNMENT - 1) / MATERIAL_BLOCK_ALIGNMENT * MATERIAL_BLOCK_ALIGNMENT;
+    uint32_t capacity = std::max(m_UniformBuffer->GetFrameCapacity() * 2, m_UniformBuffer->GetFrameCapacity() + alignedSize);
+    Log::Trace("Material uniform ring grown to {} bytes per frame", capacity);
+
+    RetireUniformBuffer();
+    m_UniformBuffer = UniformBuffer::Create(capacity);
+
+    // The regions of the new ring hold nothing yet, every slot has to rewrite whole blocks
+    for (auto& block : m_Blocks) {
+        for (auto& range : block.dirty) {
+            range.Add(0, block.size);
+        }
+    }
+
+    return m_UniformBuffer->Allocate(size);
+}
+
+void Material::RetireUniformBuffer() {
+    // NOTE: Draws recorded this frame reference the old ring and the GPU reads it for up to
+    // MAX_FRAMES_IN_FLIGHT frames, it is released once those frames are done
+    m_RetiredBuffers.push_back({RenderAPI::GetFrameIndex() + MAX_FRAMES_IN_FLIGHT, std::move(m_UniformBuffer)});
+}
+
+void Material::ReleaseRetiredBuffers(uint64_t frameIndex) {
+    std::erase_if(m_RetiredBuffers, [frameIndex](const RetiredBuffer& retired) {
+        return retired.releaseFrame <= frameIndex;
+    });
+}
+
+} // namespace forge
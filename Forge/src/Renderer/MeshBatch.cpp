@@ -0,0 +1,183 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/MeshBatch.h"
+#include "Forge/Renderer/Material.h"
+#include "Forge/Renderer/RenderAPI.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace forge {
+
+static_assert(sizeof(math::mat4f) == 64, "Batch transforms are uploaded as std430 mat4");
+
+// NOTE: One spare vertex per page, stride aligned allocations need that much slack to be found
+MeshBatch::MeshBatch(const BufferLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity, uint32_t drawCapacity,
+                     uint32_t transformBinding)
+    : m_Layout(layout)
+    , m_VertexHeap(BufferHeapUsage::Vertex, (vertexCapacity + 1) * layout.GetStride(), layout.GetStride())
+    , m_IndexHeap(BufferHeapUsage::Index, indexCapacity * static_cast<uint32_t>(sizeof(uint32_t)))
+    , m_VertexStride(layout.GetStride())
+    , m_VertexAlignment(std::lcm(layout.GetStride(), TLSFAllocator::GRANULARITY))
+    , m_DrawCapacity(drawCapacity)
+    , m_TransformBinding(transformBinding) {
+    FORGE_ASSERT(m_VertexStride > 0, "MeshBatch requires a vertex layout");
+
+    // NOTE: Draws go through one vertex array, the heaps must not grow a second page
+    m_VertexHeap.SetPageLimit(1);
+    m_IndexHeap.SetPageLimit(1);
+
+    m_IndirectBuffer = IndirectBuffer::Create(drawCapacity);
+    m_TransformBuffer =
+        StorageBuffer::Create(nullptr, drawCapacity * static_cast<uint32_t>(sizeof(math::mat4f)), BufferDrawMode::Stream);
+
+    m_Commands.reserve(drawCapacity);
+    m_DrawMeshes.reserve(drawCapacity);
+    m_Transforms.reserve(drawCapacity);
+}
+
+MeshID MeshBatch::AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount) {
+    MeshRange range;
+    range.vertices = m_VertexHeap.Allocate(vertices, vertexCount * m_VertexStride, m_VertexAlignment);
+    range.indices = m_IndexHeap.Allocate(indices, indexCount * static_cast<uint32_t>(sizeof(uint32_t)));
+    if (!range.vertices.IsValid() || !range.indices.IsValid()) {
+        Log::Error("MeshBatch is full, can't add a mesh of {} vertices and {} indices", vertexCount, indexCount);
+        if (range.vertices.IsValid()) {
+            m_VertexHeap.Free(range.vertices);
+        }
+        if (range.indices.IsValid()) {
+            m_IndexHeap.Free(range.indices);
+        }
+        return INVALID_BATCH_INDEX;
+    }
+
+    if (!m_VertexArray) {
+        Shared<VertexBuffer> vertexBuffer = m_VertexHeap.GetVertexBuffer(0);
+        Shared<IndexBuffer> indexBuffer = m_IndexHeap.GetIndexBuffer(0);
+        vertexBuffer->SetLayout(m_Layout);
+
+        m_VertexArray = VertexArrayBuffer::Create();
+        m_VertexArray->AddVertexBuffer(vertexBuffer);
+        m_VertexArray->SetIndexBuffer(indexBuffer);
+    }
+
+    range.indexCount = indexCount;
+    ResolveMesh(range);
+    m_Meshes.push_back(range);
+
+    return static_cast<MeshID>(m_Meshes.size() - 1);
+}
+
+void MeshBatch::RemoveMesh(MeshID mesh) {
+    FORGE_ASSERT(mesh < m_Meshes.size() && m_Meshes[mesh].vertices.IsValid(), "Invalid MeshBatch mesh");
+    FORGE_ASSERT(std::find(m_DrawMeshes.begin(), m_DrawMeshes.end(), mesh) == m_DrawMeshes.end(),
+                 "MeshBatch mesh removed while it still has draws");
+
+    MeshRange& range = m_Meshes[mesh];
+    m_VertexHeap.Free(range.vertices);
+    m_IndexHeap.Free(range.indices);
+    range = {};
+}
+
+uint64_t MeshBatch::Defragment(float threshold) {
+    PROFILE_FUNCTION();
+
+    uint64_t moved = m_VertexHeap.Defragment(threshold) + m_IndexHeap.Defragment(threshold);
+    if (!moved) {
+        return 0;
+    }
+
+    for (MeshRange& range : m_Meshes) {
+        if (range.vertices.IsValid()) {
+            ResolveMesh(range);
+        }
+    }
+    for (uint32_t draw = 0; draw < m_Commands.size(); draw++) {
+        const MeshRange& range = m_Meshes[m_DrawMeshes[draw]];
+        m_Commands[draw].firstIndex = range.firstIndex;
+        m_Commands[draw].baseVertex = range.baseVertex;
+        m_DirtyCommands.Add(draw);
+    }
+
+    return moved;
+}
+
+void MeshBatch::ResolveMesh(MeshRange& range) const {
+    range.firstIndex = m_IndexHeap.Resolve(range.indices).offset / static_cast<uint32_t>(sizeof(uint32_t));
+    range.baseVertex = static_cast<int32_t>(m_VertexHeap.Resolve(range.vertices).offset / m_VertexStride);
+}
+
+BatchDrawID MeshBatch::AddDraw(MeshID mesh, const math::mat4f& transform) {
+    FORGE_ASSERT(mesh < m_Meshes.size() && m_Meshes[mesh].vertices.IsValid(), "Invalid MeshBatch mesh");
+    if (m_Commands.size() >= m_DrawCapacity) {
+        Log::Error("MeshBatch draw capacity ({}) exceeded", m_DrawCapacity);
+        return INVALID_BATCH_INDEX;
+    }
+
+    auto draw = static_cast<BatchDrawID>(m_Commands.size());
+    const MeshRange& range = m_Meshes[mesh];
+
+    DrawIndexedIndirectCommand command;
+    command.indexCount = range.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = range.firstIndex;
+    command.baseVertex = range.baseVertex;
+    command.baseInstance = draw;
+
+    m_Commands.push_back(command);
+    m_DrawMeshes.push_back(mesh);
+    m_Transforms.push_back(transform);
+    m_DirtyCommands.Add(draw);
+    m_DirtyTransforms.Add(draw);
+
+    return draw;
+}
+
+void MeshBatch::SetTransform(BatchDrawID draw, const math::mat4f& transform) {
+    FORGE_ASSERT(draw < m_Transforms.size(), "Invalid MeshBatch draw");
+    m_Transforms[draw] = transform;
+    m_DirtyTransforms.Add(draw);
+}
+
+void MeshBatch::ClearDraws() {
+    m_Commands.clear();
+    m_DrawMeshes.clear();
+    m_Transforms.clear();
+    m_DirtyCommands.Clear();
+    m_DirtyTransforms.Clear();
+}
+
+void MeshBatch::Draw(RenderAPI& renderAPI, Material& material) {
+    PROFILE_FUNCTION();
+
+    if (m_Commands.empty()) {
+        return;
+    }
+
+    material.Bind();
+    UploadDirty();
+
+    m_TransformBuffer->BindBase(m_TransformBinding);
+    renderAPI.DrawIndexedIndirect(m_VertexArray, m_IndirectBuffer, GetDrawCount());
+}
+
+void MeshBatch::UploadDirty() {
+    if (!m_DirtyCommands.IsEmpty()) {
+        m_IndirectBuffer->SubmitData(m_Commands.data() + m_DirtyCommands.begin, m_DirtyCommands.end - m_DirtyCommands.begin,
+                                     m_DirtyCommands.begin);
+        m_DirtyCommands.Clear();
+    }
+
+    if (!m_DirtyTransforms.IsEmpty()) {
+        constexpr auto matrixSize = static_cast<uint32_t>(sizeof(math::mat4f));
+        m_TransformBuffer->SubmitData(m_Transforms.data() + m_DirtyTransforms.begin,
+                                      (m_DirtyTransforms.end - m_DirtyTransforms.begin) * matrixSize,
+                                      m_DirtyTransforms.begin * matrixSize);
+        m_DirtyTransforms.Clear();
+    }
+}
+
+} // namespace forge
@@ -3,11 +3,14 @@
 
 #include "Forge/Renderer/RenderAPI.h"
 #include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+#include "Null/NullRenderAPI.h"
 #include "OpenGL/OpenGLRenderAPI.h"
 
 namespace forge {
 
 Shared<RenderAPI> RenderAPI::s_Instance = nullptr;
+uint64_t RenderAPI::s_FrameIndex = 0;
 
 Shared<RenderAPI> RenderAPI::Create() {
     if (s_Instance) {
@@ -20,6 +23,9 @@ Shared<RenderAPI> RenderAPI::Create() {
     case GraphicsAPI::OpenGL:
         s_Instance = CreateShared<OpenGLRenderAPI>();
         break;
+    case GraphicsAPI::Null:
+        s_Instance = CreateShared<NullRenderAPI>();
+        break;
     case GraphicsAPI::Vulkan:
     case GraphicsAPI::DirectX12:
     case GraphicsAPI::Metal:
@@ -33,4 +39,73 @@ Shared<RenderAPI> RenderAPI::Create() {
     return s_Instance;
 }
 
+void RenderAPI::Shutdown() {
+    if (!s_Instance) {
+        return;
+    }
+
+    // NOTE: The instance may still be referenced by the application, it keeps working without
+    // its backend objects until it is released
+    s_Instance->ReleaseResources();
+    s_Instance.reset();
+}
+
+void RenderAPI::Submit(const DrawCommand& command) {
+    m_Queue.Submit(command);
+}
+
+void RenderAPI::Submit(const CommandBuffer& commandBuffer) {
+    m_Queue.Submit(commandBuffer.GetCommands());
+}
+
+void RenderAPI::Flush() {
+    PROFILE_FUNCTION();
+
+    m_QueueStats = {};
+    if (m_Queue.IsEmpty()) {
+        return;
+    }
+
+    m_Queue.Sort();
+
+    const Shader* boundShader = nullptr;
+    const VertexArrayBuffer* boundVertexArray = nullptr;
+    std::array<UniformBinding, MAX_UNIFORM_BINDING_SLOTS> boundUniforms{};
+
+    for (const DrawCommand& command : m_Queue.GetCommands()) {
+        if (command.shader != boundShader) {
+            command.shader->Bind();
+            boundShader = command.shader;
+            m_QueueStats.shaderBinds++;
+        } else {
+            m_QueueStats.redundantBindsSkipped++;
+        }
+
+        if (command.vertexArray != boundVertexArray) {
+            command.vertexArray->Bind();
+            boundVertexArray = command.vertexArray;
+            m_QueueStats.vertexArrayBinds++;
+        } else {
+            m_QueueStats.redundantBindsSkipped++;
+        }
+
+        for (uint32_t i = 0; i < command.uniformCount; i++) {
+            const UniformBinding& uniform = command.uniforms[i];
+            if (boundUniforms[uniform.binding] == uniform) {
+                m_QueueStats.redundantBindsSkipped++;
+                continue;
+            }
+
+            uniform.buffer->BindRange(uniform.binding, uniform.allocation);
+            boundUniforms[uniform.binding] = uniform;
+            m_QueueStats.uniformBinds++;
+        }
+
+        SubmitDraw(command);
+        m_QueueStats.draws++;
+    }
+
+    m_Queue.Clear();
+}
+
 } // namespace forge
@@ -0,0 +1,48 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/RenderQueue.h"
+#include "Forge/Utils/Common.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace forge {
+
+void DrawCommand::AddUniform(const UniformBuffer* buffer, const UniformAllocation& allocation, uint32_t binding) noexcept {
+    FORGE_ASSERT(uniformCount < MAX_DRAW_UNIFORM_BINDINGS, "Too many uniform bindings for one draw");
+    FORGE_ASSERT(binding < MAX_UNIFORM_BINDING_SLOTS, "Uniform binding out of range");
+    if (uniformCount < MAX_DRAW_UNIFORM_BINDINGS) {
+        uniforms[uniformCount++] = UniformBinding{buffer, allocation, binding};
+    }
+}
+
+uint64_t MakeDrawSortKey(uint16_t pipeline, uint16_t material, float depth) noexcept {
+    // NOTE: The bit pattern of a non negative float grows with its value
+    uint32_t depthBits = std::bit_cast<uint32_t>(depth > 0.0f ? depth : 0.0f);
+    return (static_cast<uint64_t>(pipeline) << 48) | (static_cast<uint64_t>(material) << 32) | depthBits;
+}
+
+void RenderQueue::Submit(const DrawCommand& command) {
+    FORGE_ASSERT(command.shader && command.vertexArray, "Draw command needs a shader and a vertex array");
+    m_Commands.push_back(command);
+}
+
+void RenderQueue::Submit(std::span<const DrawCommand> commands) {
+    m_Commands.insert(m_Commands.end(), commands.begin(), commands.end());
+}
+
+void RenderQueue::Sort() {
+    PROFILE_FUNCTION();
+
+    // Stable so equal keys keep submission order
+    std::stable_sort(m_Commands.begin(), m_Commands.end(),
+                     [](const DrawCommand& a, const DrawCommand& b) { return a.sortKey < b.sortKey; });
+}
+
+void RenderQueue::Clear() {
+    m_Commands.clear();
+}
+
+} // namespace forge
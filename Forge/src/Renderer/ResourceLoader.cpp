@@ -0,0 +1,58 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/ResourceLoader.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Platform.h"
+
+#include "Null/NullResourceLoader.h"
+#include "OpenGL/OpenGLResourceLoader.h"
+
+namespace forge {
+
+Unique<ResourceLoader> ResourceLoader::Create(const Shared<Window>& window) {
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
+
+    try {
+        switch (api) {
+        case GraphicsAPI::OpenGL:
+            return CreateUnique<OpenGLResourceLoader>(window);
+        case GraphicsAPI::Null:
+            return CreateUnique<NullResourceLoader>();
+        case GraphicsAPI::Vulkan:
+        case GraphicsAPI::DirectX12:
+        case GraphicsAPI::Metal:
+            Log::Error("ResourceLoader: {} not implemented", PlatformAPI::GetGraphicsAPIName(api));
+            FORGE_ASSERT(false, "Graphics API not implemented for ResourceLoader");
+            break;
+        default:
+            Log::Error("Unknown graphics API");
+            FORGE_ASSERT(false, "Unknown graphics API");
+        }
+    } catch (const std::exception& e) {
+        Log::Error("Failed to create resource loader: {}", e.what());
+        FORGE_ASSERT(false, e.what());
+    }
+
+    return nullptr;
+}
+
+void ResourceLoader::UploadVertexBuffer(BufferData&& data, BufferDrawMode mode, VertexBufferReadyFn ready) {
+    Submit(
+        [data = std::move(data), mode]() {
+            return VertexBuffer::Create(data.GetData(), data.GetSize(), mode);
+        },
+        std::move(ready));
+}
+
+void ResourceLoader::UploadIndexBuffer(BufferData&& data, BufferDrawMode mode, IndexBufferReadyFn ready) {
+    FORGE_ASSERT(data.GetSize() % sizeof(uint32_t) == 0, "Index data size must be a multiple of 4 bytes");
+    Submit(
+        [data = std::move(data), mode]() {
+            return IndexBuffer::Create(static_cast<const uint32_t*>(data.GetData()),
+                                       data.GetSize() / static_cast<uint32_t>(sizeof(uint32_t)), mode);
+        },
+        std::move(ready));
+}
+
+} // namespace forge
@@ -0,0 +1,225 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/Shader/AsyncShader.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Platform.h"
+#include "Forge/Utils/ThreadPool.h"
+
+#include "Null/NullShader.h"
+#include "OpenGL/OpenGLShader.h"
+
+#include <chrono>
+#include <memory>
+
+namespace forge {
+
+// NOTE: Drawn while the real program is still building, uses the same vertex input and
+// uniform block bindings as the engine shaders so the geometry shows up in place
+static constexpr const char* s_FallbackShaderSource = R"(#name fallback
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+};
+
+layout(std140, binding = 1) uniform Transform
+{
+    mat4 u_Transform;
+};
+
+void main()
+{
+    gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+void main()
+{
+    color = vec4(1.0, 0.0, 1.0, 1.0);
+}
+)";
+
+// NOTE: Shared by all pending shaders. Built with the context so the first Bind does not
+// stall on a compile, and released with it so the program never outlives the context
+static Shared<Shader> s_FallbackShader;
+
+void AsyncShader::CreateFallbackShader() noexcept {
+    if (s_FallbackShader) {
+        return;
+    }
+
+    s_FallbackShader = Shader::Create(s_FallbackShaderSource, ShaderOrigin::String);
+    if (!s_FallbackShader) {
+        Log::Error("Failed to build the fallback shader, pending shaders will not draw");
+    }
+}
+
+void AsyncShader::DestroyFallbackShader() noexcept {
+    s_FallbackShader.reset();
+}
+
+Unique<ShaderBuildTask> ShaderBuildTask::Create() noexcept {
+    auto api = PlatformAPI::GetSelectedGraphicsAPI();
+
+    switch (api) {
+    case GraphicsAPI::OpenGL:
+        return CreateUnique<OpenGLShaderBuildTask>();
+    case GraphicsAPI::Null:
+        return CreateUnique<NullShaderBuildTask>();
+    case GraphicsAPI::Vulkan:
+    case GraphicsAPI::DirectX12:
+    case GraphicsAPI::Metal:
+    case GraphicsAPI::WebGL:
+    case GraphicsAPI::None:
+        Log::Critical("This platform is not supported yet");
+        FORGE_ASSERT(false, "This platform is not supported yet");
+        return nullptr;
+    }
+
+    return nullptr;
+}
+
+AsyncShader::AsyncShader(ShaderCompileRequest request, Unique<ShaderBuildTask> task) noexcept
+    : m_Name(request.origin == ShaderOrigin::File ? request.data : "<string shader>")
+    , m_Task(std::move(task)) {
+    // NOTE: The job runs the whole pipeline serially, it already occupies a pool worker
+    // and waiting on nested jobs from there could starve the pool
+    m_Job = ThreadPool::Get().Submit([request = std::move(request), task = m_Task.get()]() {
+        ShaderCompileResult result = ShaderCompiler::CompileImmediate(request);
+        BuildResult build{std::move(result.name), false};
+        if (!result.spirv.empty()) {
+            build.prepared = task->Prepare(result.spirv);
+        }
+        return build;
+    });
+}
+
+AsyncShader::~AsyncShader() {
+    // The job references m_Task, it has to finish before the task goes away
+    if (m_Job.valid()) {
+        m_Job.wait();
+    }
+}
+
+void AsyncShader::Poll() const noexcept {
+    if (m_Status != ShaderBuildStatus::Pending) {
+        return;
+    }
+
+    if (m_Job.valid()) {
+        if (m_Job.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+
+        // The parsed #name replaces the path or placeholder the shader was created with
+        BuildResult build = m_Job.get();
+        if (!build.name.empty()) {
+            m_Name = std::move(build.name);
+        }
+
+        if (!build.prepared) {
+            Log::Critical("Failed to build shader {}", m_Name);
+            m_Status = ShaderBuildStatus::Failed;
+            return;
+        }
+    }
+
+    m_Status = m_Task->Poll(m_Shader);
+    if (m_Status == ShaderBuildStatus::Failed) {
+        Log::Critical("Failed to build shader {}", m_Name);
+    }
+}
+
+const Shader* AsyncShader::GetBoundShader() const noexcept {
+    Poll();
+    if (m_Status == ShaderBuildStatus::Ready) {
+        return m_Shader.get();
+    }
+    return s_FallbackShader.get();
+}
+
+void AsyncShader::Bind() const {
+    if (const Shader* shader = GetBoundShader()) {
+        shader->Bind();
+    }
+}
+
+void AsyncShader::UnBind() const {
+    if (const Shader* shader = GetBoundShader()) {
+        shader->UnBind();
+    }
+}
+
+bool AsyncShader::IsReady() const noexcept {
+    Poll();
+    return m_Status == ShaderBuildStatus::Ready;
+}
+
+ShaderBuildStatus AsyncShader::GetStatus() const noexcept {
+    Poll();
+    return m_Status;
+}
+
+// NOTE: Pending and failed builds report the fallback's resources, it is what gets drawn
+static const std::vector<ShaderResource> s_EmptyResources;
+
+const std::vector<ShaderResource>& AsyncShader::GetUniformBuffers() const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->GetUniformBuffers() : s_EmptyResources;
+}
+
+const std::vector<ShaderResource>& AsyncShader::GetStorageBuffers() const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->GetStorageBuffers() : s_EmptyResources;
+}
+
+const std::vector<ShaderResource>& AsyncShader::GetSamplers() const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->GetSamplers() : s_EmptyResources;
+}
+
+const std::vector<ShaderResource>& AsyncShader::GetStageInputs() const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->GetStageInputs() : s_EmptyResources;
+}
+
+const std::vector<ShaderResource>& AsyncShader::GetStageOutputs() const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->GetStageOutputs() : s_EmptyResources;
+}
+
+bool AsyncShader::HasUniformBuffer(ShaderResourceKey name) const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader && shader->HasUniformBuffer(name);
+}
+
+bool AsyncShader::HasStorageBuffer(ShaderResourceKey name) const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader && shader->HasStorageBuffer(name);
+}
+
+bool AsyncShader::HasSampler(ShaderResourceKey name) const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader && shader->HasSampler(name);
+}
+
+const ShaderResource* AsyncShader::FindResource(ShaderResourceKey name) const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->FindResource(name) : nullptr;
+}
+
+const ShaderResource* AsyncShader::FindResourceByBinding(uint32_t binding, uint32_t set) const noexcept {
+    const Shader* shader = GetBoundShader();
+    return shader ? shader->FindResourceByBinding(binding, set) : nullptr;
+}
+
+} // namespace forge
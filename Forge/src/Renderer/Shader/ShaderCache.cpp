@@ -0,0 +1,211 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/Shader/ShaderCache.h"
+#include "Forge/Utils/FileSystem.h"
+#include "Forge/Utils/Hash.h"
+#include "Forge/Utils/Log.h"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace forge {
+
+static constexpr const char* SHADER_CACHE_INDEX_FILE = "index";
+static constexpr const char* SHADER_CACHE_INDEX_HEADER = "ForgeShaderCache 1";
+
+ShaderCache& ShaderCache::Get() {
+    static ShaderCache s_Cache;
+    return s_Cache;
+}
+
+std::optional<std::vector<uint32_t>> ShaderCache::Load(uint64_t key) {
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        LoadIndex();
+
+        auto it = m_Index.find(key);
+        if (it == m_Index.end()) {
+            return std::nullopt;
+        }
+        size = it->second.size;
+    }
+
+    // NOTE: Reading happens outside the lock so compile jobs can load in parallel
+    auto binaryPath = GetBinaryPath(key);
+    try {
+        std::ifstream inFile(binaryPath, std::ios::binary);
+        if (inFile) {
+            std::vector<uint32_t> spirv(size / sizeof(uint32_t));
+            inFile.read(reinterpret_cast<char*>(spirv.data()), size);
+            if (static_cast<size_t>(inFile.gcount()) == size) {
+                return spirv;
+            }
+        }
+    } catch (const std::exception& e) {
+        Log::Error("Failed to read cached shader: {}", e.what());
+    }
+
+    // NOTE: Index and disk disagree, drop the entry so the caller recompiles
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Log::Warn("Shader cache entry {} is missing or truncated", HashToHex(key));
+    m_Index.erase(key);
+    return std::nullopt;
+}
+
+void ShaderCache::Store(uint64_t key, const std::vector<uint32_t>& spirv, const std::string& label) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        LoadIndex();
+    }
+
+    auto binaryPath = GetBinaryPath(key);
+    size_t size = spirv.size() * sizeof(uint32_t);
+
+    // NOTE: Written to a temporary file first and renamed over the final path, so a job or
+    // another process reading the binary never sees it half written. The temporary name is
+    // unique per writer, two jobs may store the same key at once.
+    auto tempPath = binaryPath;
+    tempPath += "." + GetTempSuffix();
+    try {
+        FileSystem::CreateDirectoryIfNotExists(m_CachePath);
+        std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+        if (!outFile) {
+            Log::Error("Failed to open shader cache file: {}", tempPath.string());
+            return;
+        }
+        outFile.write(reinterpret_cast<const char*>(spirv.data()), size);
+    } catch (const std::exception& e) {
+        Log::Error("Failed to cache shader: {}", e.what());
+        std::error_code error;
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, binaryPath, error);
+    if (error) {
+        Log::Error("Failed to store shader cache file {}: {}", binaryPath.string(), error.message());
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Index[key] = Entry{size, label};
+    AppendToIndex(key, size, label);
+    Log::Trace("Cached SPIR-V shader {} as {}", label, binaryPath.filename().string());
+}
+
+void ShaderCache::LoadIndex() {
+    if (m_IndexLoaded) {
+        return;
+    }
+    m_IndexLoaded = true;
+    m_CachePath = FileSystem::GetShaderCachePath();
+
+    auto indexPath = m_CachePath / SHADER_CACHE_INDEX_FILE;
+    std::ifstream indexFile(indexPath);
+    if (!indexFile) {
+        return;
+    }
+
+    std::string line;
+    if (!std::getline(indexFile, line) || line != SHADER_CACHE_INDEX_HEADER) {
+        Log::Warn("Shader cache index has an unknown format, starting with an empty cache");
+        indexFile.close();
+        std::error_code error;
+        std::filesystem::remove(indexPath, error);
+        return;
+    }
+
+    // NOTE: Each line is "<key> <size> <label>", later lines override earlier ones
+    size_t lineCount = 0;
+    while (std::getline(indexFile, line)) {
+        lineCount++;
+        std::istringstream lineStream(line);
+        std::string keyHex;
+        Entry entry;
+        if (!(lineStream >> keyHex >> entry.size)) {
+            continue;
+        }
+        std::getline(lineStream >> std::ws, entry.label);
+
+        try {
+            m_Index[std::stoull(keyHex, nullptr, 16)] = std::move(entry);
+        } catch (const std::exception&) {
+            Log::Warn("Skipping malformed shader cache index line: {}", line);
+        }
+    }
+
+    Log::Trace("Loaded shader cache index with {} entries", m_Index.size());
+
+    // NOTE: The index is append only, rewrite it without the overridden lines once they
+    // make up a good part of it so it doesn't grow with every recompile
+    indexFile.close();
+    if (lineCount > m_Index.size() * 2) {
+        RewriteIndex();
+    }
+}
+
+void ShaderCache::RewriteIndex() {
+    auto indexPath = m_CachePath / SHADER_CACHE_INDEX_FILE;
+    auto tempPath = indexPath;
+    tempPath += "." + GetTempSuffix();
+    {
+        std::ofstream indexFile(tempPath, std::ios::trunc);
+        if (!indexFile) {
+            Log::Error("Failed to compact shader cache index: {}", tempPath.string());
+            return;
+        }
+
+        indexFile << SHADER_CACHE_INDEX_HEADER << "\n";
+        for (const auto& [key, entry] : m_Index) {
+            indexFile << HashToHex(key) << " " << entry.size << " " << entry.label << "\n";
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, indexPath, error);
+    if (error) {
+        Log::Error("Failed to compact shader cache index {}: {}", indexPath.string(), error.message());
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+
+    Log::Trace("Compacted shader cache index to {} entries", m_Index.size());
+}
+
+std::string ShaderCache::GetTempSuffix() {
+    // NOTE: Thread, time and a counter keep concurrent writers in this and other processes apart
+    static std::atomic<uint64_t> s_Counter{0};
+    uint64_t unique = HashCombine(std::hash<std::thread::id>{}(std::this_thread::get_id()),
+                                  static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    unique = HashCombine(unique, s_Counter.fetch_add(1, std::memory_order_relaxed));
+    return HashToHex(unique) + ".tmp";
+}
+
+void ShaderCache::AppendToIndex(uint64_t key, size_t size, const std::string& label) {
+    auto indexPath = m_CachePath / SHADER_CACHE_INDEX_FILE;
+    bool writeHeader = !FileSystem::Exists(indexPath);
+
+    std::ofstream indexFile(indexPath, std::ios::app);
+    if (!indexFile) {
+        Log::Error("Failed to update shader cache index: {}", indexPath.string());
+        return;
+    }
+
+    if (writeHeader) {
+        indexFile << SHADER_CACHE_INDEX_HEADER << "\n";
+    }
+    indexFile << HashToHex(key) << " " << size << " " << label << "\n";
+}
+
+std::filesystem::path ShaderCache::GetBinaryPath(uint64_t key) const {
+    return m_CachePath / (HashToHex(key) + ".spv");
+}
+
+} // namespace forge
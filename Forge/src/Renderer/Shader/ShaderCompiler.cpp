@@ -0,0 +1,183 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/Shader/ShaderCompiler.h"
+#include "Forge/Renderer/Shader/ShaderCache.h"
+#include "Forge/Renderer/Shader/ShaderGenerator.h"
+#include "Forge/Renderer/Shader/ShaderParser.h"
+#include "Forge/Utils/Hash.h"
+#include "Forge/Utils/Log.h"
+#include "Forge/Utils/Profiling.h"
+
+#include <chrono>
+
+namespace forge {
+
+namespace {
+
+struct ParsedShader {
+    std::string name;
+    std::unordered_map<ShaderType, std::string> sources;
+};
+
+struct StageResult {
+    std::vector<uint32_t> spirv;
+    bool cacheHit{false};
+    bool success{false};
+};
+
+StageResult GenerateStage(const std::string& shaderName, ShaderType type, const std::string& source) {
+    PROFILE_SCOPE("ShaderCompiler::GenerateStage");
+
+    StageResult result;
+    std::string typeStr = GetShaderTypeName(type);
+    ShaderSPIRVGenerator spirvGenerator;
+
+    // NOTE: The cache key covers the preprocessed source, so edits to the shader or
+    // to anything it depends on produce a new key instead of a stale binary
+    std::string preprocessed;
+    if (!spirvGenerator.Preprocess(source, type, shaderName, preprocessed)) {
+        Log::Critical("Failed to preprocess {} shader type: {}", shaderName, typeStr);
+        return result;
+    }
+
+    uint64_t cacheKey = HashCombine(spirvGenerator.GetOptionsHash(), HashString(preprocessed));
+    cacheKey = HashCombine(cacheKey, static_cast<uint64_t>(type));
+
+    // Try to load from cache first
+    auto& cache = ShaderCache::Get();
+    if (auto cached = cache.Load(cacheKey)) {
+        result.spirv = std::move(*cached);
+        result.cacheHit = true;
+        result.success = true;
+        return result;
+    }
+
+    // Generate new SPIR-V if cache doesn't exist or couldn't be read
+    std::unordered_map<ShaderType, std::string> singleShaderSource = {{type, source}};
+    if (!spirvGenerator.Generate(singleShaderSource, shaderName, result.spirv)) {
+        Log::Critical("Failed to generate SPIR-V for {} shader type: {}", shaderName, typeStr);
+        return result;
+    }
+
+    // Cache the newly generated SPIR-V
+    cache.Store(cacheKey, result.spirv, shaderName + "." + typeStr);
+    result.success = true;
+    return result;
+}
+
+ParsedShader ParseRequest(const ShaderCompileRequest& request) {
+    ShaderParser parser(request.data, request.origin);
+    return ParsedShader{parser.GetShaderFileName(), parser.GetAllShaderSources()};
+}
+
+} // namespace
+
+ShaderCompiler::ShaderCompiler(ThreadPool& pool)
+    : m_Pool(pool) {}
+
+std::vector<ShaderCompileResult> ShaderCompiler::Compile(const std::vector<ShaderCompileRequest>& requests) {
+    PROFILE_FUNCTION();
+
+    auto startTime = std::chrono::steady_clock::now();
+    m_LastStats = {};
+
+    // Stage 1: read and split every request into its stages
+    std::vector<std::future<ParsedShader>> parseJobs;
+    parseJobs.reserve(requests.size());
+    for (const auto& request : requests) {
+        parseJobs.push_back(m_Pool.Submit([&request]() { return ParseRequest(request); }));
+    }
+
+    std::vector<ParsedShader> parsedShaders;
+    parsedShaders.reserve(requests.size());
+    for (auto& job : parseJobs) {
+        parsedShaders.push_back(job.get());
+    }
+
+    // Stage 2: fan out one job per stage across all shaders
+    struct PendingStage {
+        size_t shaderIndex;
+        ShaderType type;
+        std::future<StageResult> job;
+    };
+
+    std::vector<PendingStage> pendingStages;
+    for (size_t i = 0; i < parsedShaders.size(); i++) {
+        const auto& parsed = parsedShaders[i];
+
+        // Early skip if shader name is empty
+        if (parsed.name.empty()) {
+            Log::Critical("Shader name is empty, skipping SPIR-V generation");
+            FORGE_ASSERT(false, "Shader name is empty, skipping SPIR-V generation");
+            continue;
+        }
+
+        for (const auto& [type, source] : parsed.sources) {
+            pendingStages.push_back({i, type, m_Pool.Submit([&parsed, type, &source]() {
+                                         return GenerateStage(parsed.name, type, source);
+                                     })});
+        }
+    }
+
+    // Join before handing anything back to the context thread
+    std::vector<ShaderCompileResult> results(parsedShaders.size());
+    for (size_t i = 0; i < parsedShaders.size(); i++) {
+        results[i].name = parsedShaders[i].name;
+    }
+
+    std::vector<bool> failedShaders(parsedShaders.size(), false);
+    for (auto& pending : pendingStages) {
+        StageResult stage = pending.job.get();
+        m_LastStats.stageCount++;
+        if (!stage.success) {
+            failedShaders[pending.shaderIndex] = true;
+            continue;
+        }
+        if (stage.cacheHit) {
+            m_LastStats.cacheHits++;
+        }
+        results[pending.shaderIndex].spirv[pending.type] = std::move(stage.spirv);
+    }
+
+    // NOTE: A program linked from the stages that did compile would be half built, the
+    // whole shader fails instead
+    for (size_t i = 0; i < results.size(); i++) {
+        if (failedShaders[i]) {
+            results[i].spirv.clear();
+        }
+    }
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+    m_LastStats.shaderCount = static_cast<uint32_t>(requests.size());
+    m_LastStats.milliseconds = elapsed.count();
+
+    Log::Info("Compiled {} shaders ({} stages, {} from cache) in {:.2f} ms on {} threads", m_LastStats.shaderCount,
+              m_LastStats.stageCount, m_LastStats.cacheHits, m_LastStats.milliseconds, m_Pool.GetThreadCount());
+
+    return results;
+}
+
+ShaderCompileResult ShaderCompiler::CompileImmediate(const ShaderCompileRequest& request) {
+    PROFILE_FUNCTION();
+
+    ParsedShader parsed = ParseRequest(request);
+    ShaderCompileResult result{parsed.name, {}};
+    if (parsed.name.empty()) {
+        Log::Critical("Shader name is empty, skipping SPIR-V generation");
+        return result;
+    }
+
+    for (const auto& [type, source] : parsed.sources) {
+        StageResult stage = GenerateStage(parsed.name, type, source);
+        if (!stage.success) {
+            result.spirv.clear();
+            return result;
+        }
+        result.spirv[type] = std::move(stage.spirv);
+    }
+
+    return result;
+}
+
+} // namespace forge
@@ -3,19 +3,43 @@
 
 #include "Forge/Renderer/Shader/ShaderGenerator.h"
 #include "Forge/Utils/ErrorCodes.h"
+#include "Forge/Utils/Hash.h"
 #include "Forge/Utils/Log.h"
+#include <glslang/build_info.h>
+#include <spirv-tools/libspirv.h>
 #include <iostream>
 
 namespace forge {
 
+// NOTE: Bump when the way SPIR-V is generated changes without any visible option changing
+static constexpr uint64_t SHADER_GENERATOR_VERSION = 1;
+
+ShaderSPIRVGenerator::ShaderSPIRVGenerator(ShaderCompileOptions options)
+    : m_Options(std::move(options)) {
+    unsigned int spirvVersion = 0;
+    unsigned int spirvRevision = 0;
+    shaderc_get_spv_version(&spirvVersion, &spirvRevision);
+
+    // NOTE: The SPIR-V target version alone does not change when glslang or SPIRV-Tools are upgraded,
+    //       so the compiler and optimizer versions go into the key as well
+    m_OptionsHash = HashCombine(SHADER_GENERATOR_VERSION, spirvVersion);
+    m_OptionsHash = HashCombine(m_OptionsHash, spirvRevision);
+    m_OptionsHash = HashCombine(m_OptionsHash, GLSLANG_VERSION_MAJOR);
+    m_OptionsHash = HashCombine(m_OptionsHash, GLSLANG_VERSION_MINOR);
+    m_OptionsHash = HashCombine(m_OptionsHash, GLSLANG_VERSION_PATCH);
+    m_OptionsHash = HashCombine(m_OptionsHash, HashString(GLSLANG_VERSION_FLAVOR));
+    m_OptionsHash = HashCombine(m_OptionsHash, HashString(spvSoftwareVersionDetailsString()));
+    m_OptionsHash = HashCombine(m_OptionsHash, static_cast<uint64_t>(m_Options.optimizationLevel));
+    for (const auto& [macro, value] : m_Options.macros) {
+        m_OptionsHash = HashCombine(m_OptionsHash, HashString(macro));
+        m_OptionsHash = HashCombine(m_OptionsHash, HashString(value));
+    }
+}
+
 ErrorResult ShaderSPIRVGenerator::Generate(const std::unordered_map<ShaderType, std::string>& shadersSource, std::string name,
                                            std::vector<uint32_t>& shaderSpirvBinary) noexcept {
     shaderc::Compiler compiler;
-    shaderc::CompileOptions options;
-
-    // Like -DMY_DEFINE=1
-    options.AddMacroDefinition("MY_DEFINE", "1");
-    options.SetOptimizationLevel(shaderc_optimization_level_size);
+    shaderc::CompileOptions options = MakeCompileOptions();
 
     for (const auto& [type, source] : shadersSource) {
         shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, ToShadercType(type), name.c_str(), options);
@@ -31,6 +55,30 @@ ErrorResult ShaderSPIRVGenerator::Generate(const std::unordered_map<ShaderType,
     return ErrorCode::Success;
 }
 
+ErrorResult ShaderSPIRVGenerator::Preprocess(const std::string& source, ShaderType type, const std::string& name,
+                                             std::string& out_source) noexcept {
+    shaderc::Compiler compiler;
+    shaderc::CompileOptions options = MakeCompileOptions();
+
+    shaderc::PreprocessedSourceCompilationResult result = compiler.PreprocessGlsl(source, ToShadercType(type), name.c_str(), options);
+    if (result.GetCompilationStatus() != shaderc_compilation_status_success) {
+        std::cerr << result.GetErrorMessage();
+        return ErrorCode::ShaderCompilationFailed;
+    }
+
+    out_source.assign(result.cbegin(), result.cend());
+    return ErrorCode::Success;
+}
+
+shaderc::CompileOptions ShaderSPIRVGenerator::MakeCompileOptions() const {
+    shaderc::CompileOptions options;
+    for (const auto& [macro, value] : m_Options.macros) {
+        options.AddMacroDefinition(macro, value);
+    }
+    options.SetOptimizationLevel(m_Options.optimizationLevel);
+    return options;
+}
+
 shaderc_shader_kind ShaderSPIRVGenerator::ToShadercType(ShaderType type) {
     switch (type) {
     case ShaderType::Vertex:
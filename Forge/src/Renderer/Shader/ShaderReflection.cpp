@@ -0,0 +1,222 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/Shader/ShaderReflection.h"
+#include "Forge/Utils/Log.h"
+
+#include "spirv_cross/spirv.hpp"
+#include "spirv_cross/spirv_glsl.hpp"
+
+namespace forge {
+
+static void ReflectMembers(const spirv_cross::Compiler& compiler, const spirv_cross::Resource& resource,
+                           ShaderResource& block) {
+    const auto& blockType = compiler.get_type(resource.base_type_id);
+
+    block.members.reserve(blockType.member_types.size());
+    for (uint32_t i = 0; i < blockType.member_types.size(); i++) {
+        const auto& memberType = compiler.get_type(blockType.member_types[i]);
+
+        ShaderResourceMember member;
+        member.name = compiler.get_member_name(resource.base_type_id, i);
+        member.offset = compiler.type_struct_member_offset(blockType, i);
+        member.size = static_cast<uint32_t>(compiler.get_declared_struct_member_size(blockType, i));
+        if (!memberType.array.empty()) {
+            member.arrayStride = compiler.type_struct_member_array_stride(blockType, i);
+        }
+        if (memberType.columns > 1) {
+            member.matrixStride = compiler.type_struct_member_matrix_stride(blockType, i);
+        }
+
+        block.members.push_back(std::move(member));
+    }
+}
+
+void ShaderReflection::Reflect(const std::vector<uint32_t>& spirv, ShaderType type) {
+    try {
+        // NOTE: The base compiler is enough for reflection and is built from the words in place
+        spirv_cross::Compiler compiler(spirv.data(), spirv.size());
+        Reflect(compiler, type);
+    } catch (const spirv_cross::CompilerError& e) {
+        Log::Error("SPIRV-Cross reflection error: {}", e.what());
+    }
+}
+
+void ShaderReflection::Reflect(const spirv_cross::Compiler& compiler, ShaderType type) {
+    try {
+        spirv_cross::ShaderResources resources = compiler.get_shader_resources();
+
+        // Reflect Uniform Buffers
+        for (const auto& resource : resources.uniform_buffers) {
+            ShaderResource ubo{};
+            ubo.binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
+            ubo.set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
+            ubo.name = resource.name;
+            ubo.type = ShaderResourceType::UniformBuffer;
+
+            // Get buffer size and member count
+            const auto& bufferType = compiler.get_type(resource.base_type_id);
+            ubo.size = compiler.get_declared_struct_size(bufferType);
+            ubo.memberCount = bufferType.member_types.size();
+            ReflectMembers(compiler, resource, ubo);
+
+            m_UniformBuffers.push_back(std::move(ubo));
+        }
+
+        // Reflect Storage Buffers
+        for (const auto& resource : resources.storage_buffers) {
+            ShaderResource ssbo{};
+            ssbo.binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
+            ssbo.set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
+            ssbo.name = resource.name;
+            ssbo.type = ShaderResourceType::StorageBuffer;
+
+            const auto& bufferType = compiler.get_type(resource.base_type_id);
+            ssbo.size = compiler.get_declared_struct_size(bufferType);
+            ssbo.memberCount = bufferType.member_types.size();
+            ReflectMembers(compiler, resource, ssbo);
+
+            m_StorageBuffers.push_back(std::move(ssbo));
+        }
+
+        // Reflect Samplers
+        for (const auto& resource : resources.sampled_images) {
+            ShaderResource sampler{};
+            sampler.binding = compiler.get_decoration(resource.id, spv::DecorationBinding);
+            sampler.set = compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
+            sampler.name = resource.name;
+            sampler.type = ShaderResourceType::Sampler;
+
+            m_Samplers.push_back(sampler);
+        }
+
+        // Reflect Stage Inputs (vertex attributes for vertex shader)
+        if (type == ShaderType::Vertex) {
+            for (const auto& resource : resources.stage_inputs) {
+                ShaderResource input{};
+                input.location = compiler.get_decoration(resource.id, spv::DecorationLocation);
+                input.name = resource.name;
+                input.type = ShaderResourceType::Input;
+
+                const auto& inputType = compiler.get_type(resource.type_id);
+                input.size = inputType.vecsize * sizeof(float); // Assuming float attributes
+
+                m_StageInputs.push_back(input);
+            }
+        }
+
+        // Reflect Stage Outputs
+        for (const auto& resource : resources.stage_outputs) {
+            ShaderResource output{};
+            output.location = compiler.get_decoration(resource.id, spv::DecorationLocation);
+            output.name = resource.name;
+            output.type = ShaderResourceType::Output;
+
+            m_StageOutputs.push_back(output);
+        }
+
+    } catch (const spirv_cross::CompilerError& e) {
+        Log::Error("SPIRV-Cross reflection error: {}", e.what());
+    }
+
+    BuildIndex();
+}
+
+void ShaderReflection::BuildIndex() {
+    m_NameIndex.clear();
+    m_BindingIndex.clear();
+
+    // NOTE: emplace keeps the first entry, so resources declared by several stages resolve
+    // to the first stage and the binding table prefers UBOs, then SSBOs, then samplers
+    auto indexCollection = [this](const std::vector<ShaderResource>& collection, ShaderResourceType type, bool hasBinding) {
+        for (uint32_t i = 0; i < collection.size(); i++) {
+            const auto& resource = collection[i];
+            auto [it, inserted] = m_NameIndex.emplace(MakeNameKey(HashString(resource.name), type), ResourceRef{type, i});
+            if (!inserted && GetCollection(it->second.type)[it->second.index].name != resource.name) {
+                Log::Warn("Shader resource names {} and {} share a hash, lookups of the second one fall back to a scan",
+                          GetCollection(it->second.type)[it->second.index].name, resource.name);
+            }
+            if (hasBinding) {
+                m_BindingIndex.emplace(MakeBindingKey(resource.binding, resource.set), ResourceRef{type, i});
+            }
+        }
+    };
+
+    indexCollection(m_UniformBuffers, ShaderResourceType::UniformBuffer, true);
+    indexCollection(m_StorageBuffers, ShaderResourceType::StorageBuffer, true);
+    indexCollection(m_Samplers, ShaderResourceType::Sampler, true);
+    indexCollection(m_StageInputs, ShaderResourceType::Input, false);
+    indexCollection(m_StageOutputs, ShaderResourceType::Output, false);
+}
+
+const std::vector<ShaderResource>& ShaderReflection::GetCollection(ShaderResourceType type) const noexcept {
+    switch (type) {
+    case ShaderResourceType::UniformBuffer:
+        return m_UniformBuffers;
+    case ShaderResourceType::StorageBuffer:
+        return m_StorageBuffers;
+    case ShaderResourceType::Sampler:
+        return m_Samplers;
+    case ShaderResourceType::Input:
+        return m_StageInputs;
+    case ShaderResourceType::Output:
+    case ShaderResourceType::Unknown:
+    default:
+        return m_StageOutputs;
+    }
+}
+
+const ShaderResource* ShaderReflection::FindInIndex(ShaderResourceKey name, ShaderResourceType type) const noexcept {
+    auto it = m_NameIndex.find(MakeNameKey(name.hash, type));
+    if (it == m_NameIndex.end()) {
+        return nullptr;
+    }
+
+    const auto& collection = GetCollection(it->second.type);
+    const ShaderResource& resource = collection[it->second.index];
+    if (resource.name == name.name) {
+        return &resource;
+    }
+
+    // NOTE: Hash collision, the index only holds the first name so the others are found by scanning
+    for (const auto& candidate : collection) {
+        if (candidate.name == name.name) {
+            return &candidate;
+        }
+    }
+    return nullptr;
+}
+
+bool ShaderReflection::HasUniformBuffer(ShaderResourceKey name) const noexcept {
+    return FindInIndex(name, ShaderResourceType::UniformBuffer) != nullptr;
+}
+
+bool ShaderReflection::HasStorageBuffer(ShaderResourceKey name) const noexcept {
+    return FindInIndex(name, ShaderResourceType::StorageBuffer) != nullptr;
+}
+
+bool ShaderReflection::HasSampler(ShaderResourceKey name) const noexcept {
+    return FindInIndex(name, ShaderResourceType::Sampler) != nullptr;
+}
+
+const ShaderResource* ShaderReflection::FindResource(ShaderResourceKey name) const noexcept {
+    // Same precedence as the collections are declared in
+    for (auto type : {ShaderResourceType::UniformBuffer, ShaderResourceType::StorageBuffer, ShaderResourceType::Sampler,
+                      ShaderResourceType::Input, ShaderResourceType::Output}) {
+        if (auto* resource = FindInIndex(name, type)) {
+            return resource;
+        }
+    }
+
+    return nullptr;
+}
+
+const ShaderResource* ShaderReflection::FindResourceByBinding(uint32_t binding, uint32_t set) const noexcept {
+    auto it = m_BindingIndex.find(MakeBindingKey(binding, set));
+    if (it == m_BindingIndex.end()) {
+        return nullptr;
+    }
+    return &GetCollection(it->second.type)[it->second.index];
+}
+
+} // namespace forge
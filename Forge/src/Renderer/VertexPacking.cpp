@@ -0,0 +1,112 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Renderer/VertexPacking.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace forge {
+
+static int32_t QuantizeSnorm(float value, uint32_t bits) noexcept {
+    float scale = static_cast<float>((1u << (bits - 1)) - 1);
+    return static_cast<int32_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * scale));
+}
+
+static uint32_t QuantizeUnorm(float value, uint32_t bits) noexcept {
+    float scale = static_cast<float>((1u << bits) - 1);
+    return static_cast<uint32_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * scale));
+}
+
+uint16_t PackHalf(float value) noexcept {
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    uint32_t magnitude = bits & 0x7FFFFFFF;
+
+    // Infinity and NaN, NaNs stay quiet NaNs
+    if (magnitude >= 0x7F800000) {
+        return sign | 0x7C00 | (magnitude > 0x7F800000 ? 0x0200 : 0);
+    }
+    // 65520 and up rounds past the largest half
+    if (magnitude >= 0x477FF000) {
+        return sign | 0x7C00;
+    }
+    // Below the smallest normal half, the result is a multiple of 2^-24
+    if (magnitude < 0x38800000) {
+        float scaled = std::bit_cast<float>(magnitude) * 16777216.0f;
+        return sign | static_cast<uint16_t>(std::nearbyint(scaled));
+    }
+
+    // NOTE: Rebias the exponent from 127 to 15 and round the 13 dropped mantissa bits to
+    // nearest even, a carry out of the mantissa correctly bumps the exponent
+    uint32_t odd = (magnitude >> 13) & 1;
+    magnitude += 0xC8000000u + 0x0FFF + odd;
+    return sign | static_cast<uint16_t>(magnitude >> 13);
+}
+
+float UnpackHalf(uint16_t value) noexcept {
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+    uint32_t exponent = (value >> 10) & 0x1F;
+    uint32_t mantissa = value & 0x03FF;
+
+    if (exponent == 0) {
+        float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+    if (exponent == 0x1F) {
+        return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+std::array<uint16_t, 2> PackHalf2(const math::vec2f& value) noexcept {
+    return {PackHalf(value.x), PackHalf(value.y)};
+}
+
+std::array<uint16_t, 4> PackHalf4(const math::vec4f& value) noexcept {
+    return {PackHalf(value.x), PackHalf(value.y), PackHalf(value.z), PackHalf(value.w)};
+}
+
+uint32_t PackUnorm4x8(const math::vec4f& value) noexcept {
+    return QuantizeUnorm(value.x, 8) | QuantizeUnorm(value.y, 8) << 8 | QuantizeUnorm(value.z, 8) << 16 |
+           QuantizeUnorm(value.w, 8) << 24;
+}
+
+uint32_t PackSnorm4x8(const math::vec4f& value) noexcept {
+    auto component = [](float v) {
+        return static_cast<uint32_t>(QuantizeSnorm(v, 8)) & 0xFF;
+    };
+    return component(value.x) | component(value.y) << 8 | component(value.z) << 16 | component(value.w) << 24;
+}
+
+std::array<uint16_t, 2> PackUnorm2x16(const math::vec2f& value) noexcept {
+    return {static_cast<uint16_t>(QuantizeUnorm(value.x, 16)), static_cast<uint16_t>(QuantizeUnorm(value.y, 16))};
+}
+
+std::array<int16_t, 2> PackSnorm2x16(const math::vec2f& value) noexcept {
+    return {static_cast<int16_t>(QuantizeSnorm(value.x, 16)), static_cast<int16_t>(QuantizeSnorm(value.y, 16))};
+}
+
+std::array<int16_t, 4> PackSnorm4x16(const math::vec4f& value) noexcept {
+    return {static_cast<int16_t>(QuantizeSnorm(value.x, 16)), static_cast<int16_t>(QuantizeSnorm(value.y, 16)),
+            static_cast<int16_t>(QuantizeSnorm(value.z, 16)), static_cast<int16_t>(QuantizeSnorm(value.w, 16))};
+}
+
+uint32_t PackSnorm3x10_1x2(const math::vec4f& value) noexcept {
+    auto component = [](float v, uint32_t bits) {
+        return static_cast<uint32_t>(QuantizeSnorm(v, bits)) & ((1u << bits) - 1);
+    };
+    return component(value.x, 10) | component(value.y, 10) << 10 | component(value.z, 10) << 20 | component(value.w, 2) << 30;
+}
+
+uint32_t PackUnorm3x10_1x2(const math::vec4f& value) noexcept {
+    return QuantizeUnorm(value.x, 10) | QuantizeUnorm(value.y, 10) << 10 | QuantizeUnorm(value.z, 10) << 20 |
+           QuantizeUnorm(value.w, 2) << 30;
+}
+
+uint32_t PackNormal(const math::vec3f& normal) noexcept {
+    return PackSnorm3x10_1x2(math::vec4f(normal.x, normal.y, normal.z, 0.0f));
+}
+
+} // namespace forge
@@ -2,13 +2,113 @@
 // Distributed under the MIT License (http://opensource.org/licenses/MIT)
 
 #include "Forge/Renderer/Window.h"
+#include "Forge/Events/EventRecording.h"
+#include "Forge/Events/ImplEvent.h"
+#include "Forge/Events/InputSnapshot.h"
 #include "Forge/Utils/Common.h"
 #include "Forge/Utils/Log.h"
+#include "Forge/Utils/Platform.h"
 
+#include "Null/NullWindow.h"
 #include "Platform/Window/DefaultWindow.h"
 
 namespace forge {
 
+Window::Window() = default;
+
+Window::~Window() {
+    if (m_Recorder) {
+        m_Recorder->Close();
+    }
+}
+
+bool Window::StartRecording(const std::string& path) {
+    auto recorder = CreateUnique<EventRecorder>();
+    if (!recorder->Open(path, GetWidth(), GetHeight())) {
+        return false;
+    }
+
+    m_Recorder = std::move(recorder);
+    return true;
+}
+
+bool Window::StartReplay(const std::string& path) {
+    auto player = CreateUnique<EventPlayer>();
+    if (!player->Open(path)) {
+        return false;
+    }
+
+    const EventRecordingHeader& header = player->GetHeader();
+    if (header.width != GetWidth() || header.height != GetHeight()) {
+        Log::Warn("Replay was recorded at {}x{}, the window is {}x{}", header.width, header.height, GetWidth(), GetHeight());
+    }
+
+    m_Player = std::move(player);
+    m_ReplayClosed = false;
+    return true;
+}
+
+void Window::ProcessEvents(EventQueue& queue, const SendEventFn& send) {
+    // NOTE: Input is published with the next drawn frame, records are keyed by that frame
+    uint64_t frame = InputState::Get().GetFrame();
+    InputState::DispatchScope dispatchScope;
+
+    if (!m_Player) {
+        queue.Drain([&](const EventRecord& record) {
+            // Dropped file lists live outside the record and can't be replayed
+            if (m_Recorder && record.type != EventType::Drop) {
+                m_Recorder->Record(frame, record);
+            }
+            send(record);
+        });
+        return;
+    }
+
+    queue.Discard([&](const EventRecord& record) {
+        if (record.type == EventType::Window && record.action == Action::Close) {
+            send(record);
+        }
+    });
+
+    m_Player->Play(frame, [&](const EventRecord& record) {
+        EventQueue::ApplyState(record);
+        send(record);
+    });
+
+    if (m_Player->IsFinished() && !m_ReplayClosed) {
+        Log::Info("Replay finished: {} events over {} frames, recorded session took {:.2f} s", m_Player->GetPlayedCount(),
+                  frame + 1, m_Player->GetRecordedTime());
+        m_ReplayClosed = true;
+        send(EventRecord{EventType::Window, Action::Close});
+    }
+}
+
+void Window::SendEvent(const EventRecord& record, const EventCallbackFn& callback) {
+    if (!callback) {
+        return;
+    }
+
+    switch (record.type) {
+    case EventType::Window: {
+        WindowEvent event(static_cast<int>(record.x), static_cast<int>(record.y), record.action);
+        callback(event);
+        break;
+    }
+    case EventType::Key: {
+        KeyEvent event(record.code, record.action);
+        callback(event);
+        break;
+    }
+    case EventType::Mouse: {
+        MouseEvent event(record.x, record.y, record.action);
+        callback(event);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
 Shared<Window> Window::Create(const WindowDescriptor& descriptor) {
 
     FORGE_ASSERT(descriptor.width > 0, "Window width must be greater than 0");
@@ -24,6 +124,11 @@ Shared<Window> Window::Create(const WindowDescriptor& descriptor) {
         Log::Info("  - Resizable: {}", descriptor.resizable ? "yes" : "no");
         Log::Info("  - Fullscreen: {}", descriptor.fullscreen ? "yes" : "no");
 
+        // NOTE: The Null backend runs headless, without a native window
+        if (PlatformAPI::GetSelectedGraphicsAPI() == GraphicsAPI::Null) {
+            return CreateShared<NullWindow>(descriptor);
+        }
+
         // TODO: Switch by Platform for now is supported only glfw
         return CreateShared<DefaultWindow>(std::move(descriptor));
 
@@ -0,0 +1,314 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Utils/TLSFAllocator.h"
+#include "Forge/Utils/Common.h"
+
+#include <bit>
+
+namespace forge {
+
+TLSFAllocator::TLSFAllocator(uint32_t capacity)
+    : m_Capacity(capacity / GRANULARITY * GRANULARITY) {
+    Reset();
+}
+
+void TLSFAllocator::Reset() {
+    m_Blocks.clear();
+    m_UnusedNodes.clear();
+    m_FirstLevelMap = 0;
+    m_SecondLevelMap.fill(0);
+    for (auto& lists : m_FreeLists) {
+        lists.fill(NONE);
+    }
+    m_UsedSize = 0;
+
+    if (m_Capacity == 0) {
+        return;
+    }
+
+    uint32_t node = NewNode();
+    m_Blocks[node].offset = 0;
+    m_Blocks[node].size = m_Capacity;
+    InsertFree(node);
+}
+
+void TLSFAllocator::Mapping(uint32_t size, uint32_t& fl, uint32_t& sl) noexcept {
+    if (size < SMALL_BLOCK_SIZE) {
+        fl = 0;
+        sl = size / (SMALL_BLOCK_SIZE / SL_COUNT);
+        return;
+    }
+
+    uint32_t highBit = static_cast<uint32_t>(std::bit_width(size)) - 1;
+    sl = (size >> (highBit - SL_COUNT_LOG2)) ^ SL_COUNT;
+    fl = highBit - FL_SHIFT + 1;
+}
+
+uint32_t TLSFAllocator::FindFreeBlock(uint32_t size) const noexcept {
+    // NOTE: Round up to the next list boundary so any block of the found list fits (good fit)
+    if (size >= SMALL_BLOCK_SIZE) {
+        uint32_t round = (1u << (static_cast<uint32_t>(std::bit_width(size)) - 1 - SL_COUNT_LOG2)) - 1;
+        if (size <= UINT32_MAX - round) {
+            size += round;
+        }
+    }
+
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Mapping(size, fl, sl);
+    if (fl >= FL_COUNT) {
+        return NONE;
+    }
+
+    uint32_t slMap = m_SecondLevelMap[fl] & (~0u << sl);
+    if (!slMap) {
+        uint32_t flMap = fl + 1 < 32 ? m_FirstLevelMap & (~0u << (fl + 1)) : 0;
+        if (!flMap) {
+            return NONE;
+        }
+        fl = static_cast<uint32_t>(std::countr_zero(flMap));
+        slMap = m_SecondLevelMap[fl];
+    }
+    sl = static_cast<uint32_t>(std::countr_zero(slMap));
+
+    return m_FreeLists[fl][sl];
+}
+
+void TLSFAllocator::InsertFree(uint32_t node) {
+    Block& block = m_Blocks[node];
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Mapping(block.size, fl, sl);
+
+    block.free = true;
+    block.prevFree = NONE;
+    block.nextFree = m_FreeLists[fl][sl];
+    if (block.nextFree != NONE) {
+        m_Blocks[block.nextFree].prevFree = node;
+    }
+    m_FreeLists[fl][sl] = node;
+
+    m_FirstLevelMap |= 1u << fl;
+    m_SecondLevelMap[fl] |= 1u << sl;
+}
+
+void TLSFAllocator::RemoveFree(uint32_t node) {
+    Block& block = m_Blocks[node];
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Mapping(block.size, fl, sl);
+
+    if (block.prevFree != NONE) {
+        m_Blocks[block.prevFree].nextFree = block.nextFree;
+    } else {
+        m_FreeLists[fl][sl] = block.nextFree;
+    }
+    if (block.nextFree != NONE) {
+        m_Blocks[block.nextFree].prevFree = block.prevFree;
+    }
+
+    if (m_FreeLists[fl][sl] == NONE) {
+        m_SecondLevelMap[fl] &= ~(1u << sl);
+        if (!m_SecondLevelMap[fl]) {
+            m_FirstLevelMap &= ~(1u << fl);
+        }
+    }
+
+    block.free = false;
+    block.prevFree = NONE;
+    block.nextFree = NONE;
+}
+
+void TLSFAllocator::SplitTail(uint32_t node, uint32_t size) {
+    uint32_t tail = NewNode();
+    Block& block = m_Blocks[node];
+    Block& rest = m_Blocks[tail];
+
+    rest.offset = block.offset + size;
+    rest.size = block.size - size;
+    rest.prevPhysical = node;
+    rest.nextPhysical = block.nextPhysical;
+    if (rest.nextPhysical != NONE) {
+        m_Blocks[rest.nextPhysical].prevPhysical = tail;
+    }
+    block.nextPhysical = tail;
+    block.size = size;
+
+    InsertFree(Merge(tail));
+}
+
+void TLSFAllocator::SplitHead(uint32_t node, uint32_t size) {
+    uint32_t head = NewNode();
+    Block& block = m_Blocks[node];
+    Block& front = m_Blocks[head];
+
+    front.offset = block.offset;
+    front.size = size;
+    front.nextPhysical = node;
+    front.prevPhysical = block.prevPhysical;
+    if (front.prevPhysical != NONE) {
+        m_Blocks[front.prevPhysical].nextPhysical = head;
+    }
+    block.prevPhysical = head;
+    block.offset += size;
+    block.size -= size;
+
+    InsertFree(Merge(head));
+}
+
+uint32_t TLSFAllocator::Merge(uint32_t node) {
+    // NOTE: Expects node to be outside the free lists, merged neighbours are removed from them
+    uint32_t prev = m_Blocks[node].prevPhysical;
+    if (prev != NONE && m_Blocks[prev].free) {
+        RemoveFree(prev);
+        Block& block = m_Blocks[node];
+        Block& previous = m_Blocks[prev];
+        previous.size += block.size;
+        previous.nextPhysical = block.nextPhysical;
+        if (block.nextPhysical != NONE) {
+            m_Blocks[block.nextPhysical].prevPhysical = prev;
+        }
+        ReleaseNode(node);
+        node = prev;
+    }
+
+    uint32_t next = m_Blocks[node].nextPhysical;
+    if (next != NONE && m_Blocks[next].free) {
+        RemoveFree(next);
+        Block& block = m_Blocks[node];
+        Block& following = m_Blocks[next];
+        block.size += following.size;
+        block.nextPhysical = following.nextPhysical;
+        if (following.nextPhysical != NONE) {
+            m_Blocks[following.nextPhysical].prevPhysical = node;
+        }
+        ReleaseNode(next);
+    }
+
+    return node;
+}
+
+uint32_t TLSFAllocator::NewNode() {
+    if (!m_UnusedNodes.empty()) {
+        uint32_t node = m_UnusedNodes.back();
+        m_UnusedNodes.pop_back();
+        m_Blocks[node] = Block{};
+        return node;
+    }
+
+    m_Blocks.emplace_back();
+    return static_cast<uint32_t>(m_Blocks.size() - 1);
+}
+
+void TLSFAllocator::ReleaseNode(uint32_t node) {
+    m_Blocks[node] = Block{};
+    m_UnusedNodes.push_back(node);
+}
+
+TLSFAllocation TLSFAllocator::Allocate(uint32_t size, uint32_t alignment) {
+    FORGE_ASSERT(alignment > 0 && alignment % GRANULARITY == 0, "TLSF alignment must be a multiple of the granularity");
+
+    size = (size + GRANULARITY - 1) / GRANULARITY * GRANULARITY;
+    if (size == 0 || size > m_Capacity) {
+        return {};
+    }
+
+    // NOTE: A block this large has room for the padding whatever its offset is
+    uint32_t searchSize = alignment > GRANULARITY ? size + alignment - GRANULARITY : size;
+    uint32_t node = FindFreeBlock(searchSize);
+    if (node == NONE) {
+        return {};
+    }
+
+    RemoveFree(node);
+
+    uint32_t offset = m_Blocks[node].offset;
+    uint32_t padding = (offset + alignment - 1) / alignment * alignment - offset;
+    if (padding) {
+        SplitHead(node, padding);
+    }
+    if (m_Blocks[node].size > size) {
+        SplitTail(node, size);
+    }
+
+    m_UsedSize += size;
+    return TLSFAllocation{m_Blocks[node].offset, size, node};
+}
+
+TLSFAllocation TLSFAllocator::AllocateAt(uint32_t offset, uint32_t size) {
+    FORGE_ASSERT(offset % GRANULARITY == 0, "TLSF offsets must be a multiple of the granularity");
+
+    size = (size + GRANULARITY - 1) / GRANULARITY * GRANULARITY;
+    if (size == 0 || offset > m_Capacity || size > m_Capacity - offset) {
+        return {};
+    }
+
+    // NOTE: Largest lists first, when the caller rebuilds a compacted layout front to back the
+    // range is always in the tail block, which sits in the highest list
+    for (int fl = static_cast<int>(FL_COUNT) - 1; fl >= 0; fl--) {
+        if (!(m_FirstLevelMap & (1u << fl))) {
+            continue;
+        }
+        for (int sl = static_cast<int>(SL_COUNT) - 1; sl >= 0; sl--) {
+            for (uint32_t node = m_FreeLists[fl][sl]; node != NONE; node = m_Blocks[node].nextFree) {
+                const Block& block = m_Blocks[node];
+                if (block.offset > offset || block.offset + block.size < offset + size) {
+                    continue;
+                }
+
+                RemoveFree(node);
+                if (offset > m_Blocks[node].offset) {
+                    SplitHead(node, offset - m_Blocks[node].offset);
+                }
+                if (m_Blocks[node].size > size) {
+                    SplitTail(node, size);
+                }
+
+                m_UsedSize += size;
+                return TLSFAllocation{offset, size, node};
+            }
+        }
+    }
+
+    return {};
+}
+
+void TLSFAllocator::Free(const TLSFAllocation& allocation) {
+    if (!allocation.IsValid()) {
+        return;
+    }
+
+    FORGE_ASSERT(allocation.node < m_Blocks.size() && !m_Blocks[allocation.node].free &&
+                     m_Blocks[allocation.node].offset == allocation.offset,
+                 "Freeing an allocation that is not live");
+
+    m_UsedSize -= m_Blocks[allocation.node].size;
+    InsertFree(Merge(allocation.node));
+}
+
+uint32_t TLSFAllocator::GetLargestFreeBlock() const noexcept {
+    if (!m_FirstLevelMap) {
+        return 0;
+    }
+
+    // NOTE: The highest non empty list holds the largest blocks, its entries are not sorted
+    uint32_t fl = 31 - static_cast<uint32_t>(std::countl_zero(m_FirstLevelMap));
+    uint32_t sl = 31 - static_cast<uint32_t>(std::countl_zero(m_SecondLevelMap[fl]));
+
+    uint32_t largest = 0;
+    for (uint32_t node = m_FreeLists[fl][sl]; node != NONE; node = m_Blocks[node].nextFree) {
+        largest = m_Blocks[node].size > largest ? m_Blocks[node].size : largest;
+    }
+    return largest;
+}
+
+float TLSFAllocator::GetFragmentation() const noexcept {
+    uint32_t freeSize = GetFreeSize();
+    if (freeSize == 0) {
+        return 0.0f;
+    }
+    return 1.0f - static_cast<float>(GetLargestFreeBlock()) / static_cast<float>(freeSize);
+}
+
+} // namespace forge
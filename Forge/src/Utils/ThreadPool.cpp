@@ -0,0 +1,57 @@
+// Copyright (c) 2025-present, Rusu Alexei & Project contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include "Forge/Utils/ThreadPool.h"
+#include <algorithm>
+
+namespace forge {
+
+ThreadPool::ThreadPool(uint32_t threadCount) {
+    // NOTE: hardware_concurrency may report 0 when it can't be detected
+    threadCount = std::max(threadCount, 1u);
+
+    m_Workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++) {
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+
+    for (auto& worker : m_Workers) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::Get() {
+    static ThreadPool s_Pool;
+    return s_Pool;
+}
+
+void ThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Condition.wait(lock, [this]() {
+                return m_Stopping || !m_Jobs.empty();
+            });
+
+            // NOTE: Drain the queue before exiting so no submitted future is left unsatisfied
+            if (m_Stopping && m_Jobs.empty()) {
+                return;
+            }
+
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop();
+        }
+        job();
+    }
+}
+
+} // namespace forge
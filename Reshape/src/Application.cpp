@@ -3,30 +3,45 @@
 
 #include "Application.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace reshape {
 
-Application::Application() {
+Application::Application(const CommandLineOptions& options)
+    : m_Options(options) {
     forge::Log::Info("Application constructor");
     m_Window = forge::Window::Create();
-    m_Window->SetEventCallback(std::bind(&Application::HandleEvent, this, std::placeholders::_1));
+    m_Window->SetEventCallback([this](forge::Event& event) {
+        m_Dispatcher.Dispatch(event);
+    });
 
     m_Context = forge::GraphicsContext::Create(m_Window);
     m_RenderAPI = forge::RenderAPI::Create();
+    m_ResourceLoader = forge::ResourceLoader::Create(m_Window);
+
+    // NOTE: A replay swaps the window's input for the recorded stream
+    bool replaying = !m_Options.replayPath.empty() && m_Window->StartReplay(m_Options.replayPath);
+    if (!replaying && !m_Options.recordPath.empty()) {
+        m_Window->StartRecording(m_Options.recordPath);
+    }
 
-    // Create shader
-    m_Shader = forge::Shader::Create("shaders/main.glsl", forge::ShaderOrigin::File);
-    m_Shader->Bind();
+    // NOTE: Benchmark runs with a frame limit and replays draw flat out, replays also step
+    // animations by a fixed time so every run draws the same frames. Otherwise the viewport
+    // only draws when something changed or the cube is rotating.
+    bool benchmark = m_Options.frameLimit != 0 || replaying;
+    forge::FrameSchedulerDescriptor schedulerDescriptor;
+    schedulerDescriptor.continuous = benchmark;
+    schedulerDescriptor.vsync = !benchmark;
+    schedulerDescriptor.fixedDeltaTime = replaying ? 1.0 / 60.0 : 0.0;
+    m_Scheduler = CreateUnique<forge::FrameScheduler>(m_Window, schedulerDescriptor);
+    m_Scheduler->BeginAnimation();
+    SubscribeEvents();
 
-    // Create uniform buffers using GLAD directly
-    glGenBuffers(1, &m_CameraUBO);
-    glBindBuffer(GL_UNIFORM_BUFFER, m_CameraUBO);
-    glBufferData(GL_UNIFORM_BUFFER, sizeof(forge::math::mat4f), nullptr, GL_DYNAMIC_DRAW);
-    glBindBufferBase(GL_UNIFORM_BUFFER, 0, m_CameraUBO); // binding = 0
+    // NOTE: Built in the background, the fallback program is drawn until it is ready
+    m_Shader = forge::Shader::CreateAsync("shaders/main.glsl", forge::ShaderOrigin::File);
 
-    glGenBuffers(1, &m_TransformUBO);
-    glBindBuffer(GL_UNIFORM_BUFFER, m_TransformUBO);
-    glBufferData(GL_UNIFORM_BUFFER, sizeof(forge::math::mat4f), nullptr, GL_DYNAMIC_DRAW);
-    glBindBufferBase(GL_UNIFORM_BUFFER, 1, m_TransformUBO); // binding = 1
+    m_Material = CreateShared<forge::Material>(m_Shader);
 
     // Cube vertices with positions and colors
     struct Vertex {
@@ -85,17 +100,30 @@ Application::Application() {
         20, 21, 22, 22, 23, 20
     };
 
-    // Create and setup buffers
-    m_VBO = forge::VertexBuffer::Create(vertices, sizeof(vertices));
-
-    forge::BufferLayout layout = {{forge::BufferDataType::Float3, "a_Position"}, {forge::BufferDataType::Float3, "a_Color"}};
-    m_VBO->SetLayout(layout);
-
-    m_EBO = forge::IndexBuffer::Create(indices, sizeof(indices) / sizeof(uint32_t));
+    struct MeshBuffers {
+        Shared<forge::VertexBuffer> vertexBuffer;
+        Shared<forge::IndexBuffer> indexBuffer;
+    };
 
-    m_VAO = forge::VertexArrayBuffer::Create();
-    m_VAO->AddVertexBuffer(m_VBO);
-    m_VAO->SetIndexBuffer(m_EBO);
+    // NOTE: Buffers are created and filled on the loader thread, the vertex array belongs to
+    // this context so it is assembled once the upload finished. Nothing is drawn until then.
+    m_ResourceLoader->Submit(
+        [vertices, indices]() {
+            MeshBuffers buffers;
+            buffers.vertexBuffer = forge::VertexBuffer::Create(vertices);
+            buffers.vertexBuffer->SetLayout(
+                {{forge::BufferDataType::Float3, "a_Position"}, {forge::BufferDataType::Float3, "a_Color"}});
+            buffers.indexBuffer = forge::IndexBuffer::Create(indices);
+            return buffers;
+        },
+        [this](MeshBuffers&& buffers) {
+            m_VBO = std::move(buffers.vertexBuffer);
+            m_EBO = std::move(buffers.indexBuffer);
+
+            m_VAO = forge::VertexArrayBuffer::Create();
+            m_VAO->AddVertexBuffer(m_VBO);
+            m_VAO->SetIndexBuffer(m_EBO);
+        });
 
     // Setup camera view and projection
     forge::math::mat4f view =
@@ -106,63 +134,109 @@ Application::Application() {
     forge::math::mat4f projection = forge::math::perspective(forge::math::radians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
 
     m_ViewProjection = projection * view;
-
-    // Update camera UBO
-    glBindBuffer(GL_UNIFORM_BUFFER, m_CameraUBO);
-    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(forge::math::mat4f), &m_ViewProjection);
-
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
+    m_Material->Set("u_ViewProjection", m_ViewProjection);
 }
 
-Application::~Application() {
-    // Cleanup OpenGL UBOs
-    glDeleteBuffers(1, &m_CameraUBO);
-    glDeleteBuffers(1, &m_TransformUBO);
-}
+Application::~Application() {}
 
 void Application::Run() {
+    uint32_t frameCount = 0;
+    auto startTime = std::chrono::steady_clock::now();
+
     while (m_IsRunning) {
+        // Uploads are only published from a drawn frame
+        if (m_ResourceLoader->GetPendingCount() > 0) {
+            m_Scheduler->RequestRedraw();
+        }
+        if (!m_Scheduler->BeginFrame()) {
+            continue;
+        }
+
         PROFILE_SCOPE("Main Loop");
 
+        m_RenderAPI->BeginFrame();
+        m_ResourceLoader->Poll();
+
         forge::ClearState clearState;
         clearState.color = {0.1f, 0.1f, 0.1f, 1.0f};
         clearState.clearColor = true;
         clearState.clearDepth = true;
         m_RenderAPI->Clear(clearState);
-        // Clear depth buffer at the beginning of each frame
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Update transform matrix for rotation
-        static float rotation = 0.0f;
-        rotation += 0.001f;
-        m_Transform = forge::math::rotate(forge::math::mat4f(1.0f), rotation, forge::math::vec3f(1.0f, 1.0f, 0.0f));
+        // Update transform matrix for rotation, in radians per second
+        if (m_IsRotating) {
+            m_Rotation += 0.5f * static_cast<float>(m_Scheduler->GetDeltaTime());
+        }
+        m_Transform = forge::math::rotate(forge::math::mat4f(1.0f), m_Rotation, forge::math::vec3f(1.0f, 1.0f, 0.0f));
+
+        // Only the transform changes, the camera block is not uploaded again
+        static constexpr forge::ShaderResourceKey s_TransformKey{"u_Transform"};
+        m_Material->Set(s_TransformKey, m_Transform);
+
+        // Queue the cube, state is bound when the queue is flushed
+        if (m_VAO) {
+            forge::DrawCommand command;
+            command.sortKey = forge::MakeDrawSortKey(m_Shader->GetSortID(), m_Material->GetSortID(), 0.0f);
+            command.vertexArray = m_VAO.get();
+            m_Material->Prepare(command);
+            m_RenderAPI->Submit(command);
+        }
 
-        // Update transform UBO
-        glBindBuffer(GL_UNIFORM_BUFFER, m_TransformUBO);
-        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(forge::math::mat4f), &m_Transform);
+        m_RenderAPI->Flush();
 
-        // Bind shader
-        m_Shader->Bind();
+        m_RenderAPI->EndFrame();
+        m_Context->SwapBuffers();
+        m_Scheduler->EndFrame();
 
-        // Draw cube
-        m_VAO->Bind();
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-        m_VAO->Unbind();
+        if (m_Options.frameLimit && ++frameCount >= m_Options.frameLimit) {
+            m_IsRunning = false;
+        }
+    }
 
-        m_Context->SwapBuffers();
-        m_Window->Update();
+    if (m_Options.frameLimit) {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+        forge::Log::Info("Rendered {} frames in {:.2f} ms ({:.3f} ms/frame)", frameCount, elapsed.count(),
+                         frameCount ? elapsed.count() / frameCount : 0.0);
     }
+
+    forge::FrameStats stats = m_Scheduler->GetStats();
+    forge::Log::Info("Frame time over the last {} frames: avg {:.3f} ms, min {:.3f} ms, max {:.3f} ms, p99 {:.3f} ms",
+                     std::min<uint64_t>(stats.frames, forge::FrameScheduler::STATS_WINDOW), stats.averageFrameTime,
+                     stats.minFrameTime, stats.maxFrameTime, stats.p99FrameTime);
+    forge::Log::Info("Drew {} frames, woke up {} times while idle", stats.frames, stats.idleWaits);
 }
 
-void Application::HandleEvent(const forge::Event& event) {
-    if (event.GetType() == forge::EventType::Window) {
-        forge::WindowEvent windowEvent = static_cast<const forge::WindowEvent&>(event);
-        if (windowEvent.GetAction() == forge::Action::Close) {
-            forge::Log::Trace("Window Closed Event");
-            m_IsRunning = false;
+void Application::SubscribeEvents() {
+    // NOTE: Any input or window change may alter what is on screen, seen before anything
+    // can consume the event
+    m_Dispatcher.Subscribe(
+        forge::EventType::None, forge::Action::None,
+        [this](const forge::Event&) {
+            m_Scheduler->RequestRedraw();
+            return false;
+        },
+        forge::EventPriority::Overlay);
+
+    m_Dispatcher.Subscribe<forge::WindowEvent>(forge::Action::Close, [this](const forge::WindowEvent&) {
+        forge::Log::Trace("Window Closed Event");
+        m_IsRunning = false;
+        return true;
+    });
+
+    // Space pauses the rotation, the viewport goes idle while it is paused
+    m_Dispatcher.Subscribe<forge::KeyEvent>(forge::Action::KeyPress, [this](const forge::KeyEvent& event) {
+        if (event.GetKey() != forge::Key::Space) {
+            return false;
         }
-    }
-};
+
+        m_IsRotating = !m_IsRotating;
+        if (m_IsRotating) {
+            m_Scheduler->BeginAnimation();
+        } else {
+            m_Scheduler->EndAnimation();
+        }
+        return true;
+    });
+}
 
 } // namespace reshape
@@ -4,37 +4,43 @@
 #ifndef APPLICATION_H
 #define APPLICATION_H
 
-#include "glad/glad.h"
-
 #include "Forge/Forge.hpp"
+#include "Utils/Parsing.h"
 
 namespace reshape {
 
 class Application {
 public:
-    Application();
+    explicit Application(const CommandLineOptions& options = {});
     ~Application();
 
     void Run();
 
 protected:
-    void HandleEvent(const forge::Event& event);
+    void SubscribeEvents();
 
 private:
+    CommandLineOptions m_Options;
+
     Shared<forge::Window> m_Window;
     Shared<forge::Shader> m_Shader;
     Shared<forge::RenderAPI> m_RenderAPI;
     Unique<forge::GraphicsContext> m_Context;
+    // NOTE: Declared after the context so it is destroyed while the context is still alive
+    Unique<forge::ResourceLoader> m_ResourceLoader;
+    Unique<forge::FrameScheduler> m_Scheduler;
+
+    forge::EventDispatcher m_Dispatcher;
 
     bool m_IsRunning{true};
+    bool m_IsRotating{true};
+    float m_Rotation{0.0f};
 
     Shared<forge::VertexArrayBuffer> m_VAO;
     Shared<forge::VertexBuffer> m_VBO;
     Shared<forge::IndexBuffer> m_EBO;
 
-    // Temporary OpenGL UBO handles until Forge UBO is implemented
-    uint32_t m_CameraUBO{0};
-    uint32_t m_TransformUBO{0};
+    Shared<forge::Material> m_Material;
 
     forge::math::mat4f m_ViewProjection{1.0f};
     forge::math::mat4f m_Transform{1.0f};
@@ -4,6 +4,7 @@
 #include "Parsing.h"
 #include <algorithm>
 #include <cctype>
+#include <cstdlib>
 
 namespace reshape {
 
@@ -27,12 +28,14 @@ forge::GraphicsAPI CommandLineParser::ParseGraphicsAPI(const std::string& apiStr
         return forge::GraphicsAPI::Metal;
     if (api == "webgl")
         return forge::GraphicsAPI::WebGL;
+    if (api == "null" || api == "headless")
+        return forge::GraphicsAPI::Null;
 
     return forge::GraphicsAPI::None;
 }
 
 void CommandLineParser::PrintUsage() {
-    forge::Log::Info("Usage: Reshape [--api <graphics_api>]");
+    forge::Log::Info("Usage: Reshape [--api <graphics_api>] [--frames <count>] [--record <file> | --replay <file>]");
     forge::Log::Info("Available Graphics APIs:");
 
     auto availableAPIs = forge::PlatformAPI::GetAvailableGraphicsAPIs();
@@ -41,22 +44,27 @@ void CommandLineParser::PrintUsage() {
     }
 }
 
-forge::GraphicsAPI CommandLineParser::ParseCommandLine(int argc, char* argv[], bool& apiSpecified) {
-    forge::GraphicsAPI selectedAPI = forge::PlatformAPI::GetDefaultGraphicsAPI();
-    apiSpecified = false;
+CommandLineOptions CommandLineParser::ParseCommandLine(int argc, char* argv[]) {
+    CommandLineOptions options;
 
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
         if (arg == "--api" && i + 1 < argc) {
-            apiSpecified = true;
-            selectedAPI = ParseGraphicsAPI(argv[++i]);
+            options.apiSpecified = true;
+            options.graphicsAPI = ParseGraphicsAPI(argv[++i]);
+        } else if (arg == "--frames" && i + 1 < argc) {
+            options.frameLimit = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--record" && i + 1 < argc) {
+            options.recordPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            options.replayPath = argv[++i];
         } else if (arg == "--help" || arg == "-h") {
             PrintUsage();
             exit(0);
         }
     }
 
-    return selectedAPI;
+    return options;
 }
 
 } // namespace reshape
@@ -5,16 +5,27 @@
 #define PARSING_H
 
 #include "Forge/Forge.hpp"
+#include <cstdint>
 #include <string>
 
 namespace reshape {
 
+struct CommandLineOptions {
+    forge::GraphicsAPI graphicsAPI{forge::PlatformAPI::GetDefaultGraphicsAPI()};
+    bool apiSpecified{false};
+    // NOTE: 0 keeps running until the window is closed
+    uint32_t frameLimit{0};
+    // NOTE: Event recording written with --record and played back with --replay
+    std::string recordPath;
+    std::string replayPath;
+};
+
 class CommandLineParser {
 public:
     static std::string ToLower(std::string str);
     static forge::GraphicsAPI ParseGraphicsAPI(const std::string& apiStr);
     static void PrintUsage();
-    static forge::GraphicsAPI ParseCommandLine(int argc, char* argv[], bool& apiSpecified);
+    static CommandLineOptions ParseCommandLine(int argc, char* argv[]);
 };
 
 } // namespace reshape
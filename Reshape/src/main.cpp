@@ -19,13 +19,13 @@ int main(int argc, char* argv[]) {
         forge::Log::Critical("Error setting current path:  {0}", ex.what());
     }
 
+    reshape::CommandLineOptions options = reshape::CommandLineParser::ParseCommandLine(argc, argv);
     {
         // TODO: Cleanup this code later
-        bool apiSpecified;
         forge::Log::Critical("Configuring for Platform: {}",
                              forge::PlatformAPI::GetPlatformName(forge::PlatformAPI::GetCurrentPlatform()));
-        forge::GraphicsAPI selectedAPI = reshape::CommandLineParser::ParseCommandLine(argc, argv, apiSpecified);
-        if (apiSpecified) {
+        forge::GraphicsAPI selectedAPI = options.graphicsAPI;
+        if (options.apiSpecified) {
             if (selectedAPI == forge::GraphicsAPI::None) {
                 forge::Log::Error("Invalid Graphics API specified!");
                 reshape::CommandLineParser::PrintUsage();
@@ -42,7 +42,7 @@ int main(int argc, char* argv[]) {
     }
 
     // NOTE: Initialize and run the application
-    reshape::Application application;
+    reshape::Application application(options);
     application.Run();
 
     return 0;